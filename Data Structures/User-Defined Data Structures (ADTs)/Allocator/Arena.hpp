@@ -0,0 +1,181 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+
+// Allocator is a separate class (or struct) that a container uses to get its memory.
+// By default our Vector , Stack and String use std::allocator which calls new / delete every time.
+// Here we make a Monotonic Arena and an allocator that plugs it into any of those containers.
+
+// Monotonic Arena :
+// It grabs one big block from the heap and then hands out memory by just moving a pointer forward (bump).
+// deallocate() does nothing , memory only comes back all at once by release() or the destructor.
+// When a block is full , a new block (twice as big) is taken from the heap and chained to the old ones.
+// This is perfect for short-lived containers (e.g per request data) : allocating is a few instructions,
+// and freeing thousands of objects is a single release() at the end.
+// Same idea as std::pmr::monotonic_buffer_resource (C++ 17).
+class Arena
+{
+    // Header placed at the start of every block taken from the heap , links the blocks together
+    struct Block
+    {
+        Block *prev;
+        size_t size; // Usable bytes after the header
+    };
+
+    Block *current; // Newest block , where we bump from
+    char *ptr;      // Next free byte inside current block
+    char *limit;    // One past the last byte of current block
+    size_t next_size;
+
+    void add_block(size_t min_bytes)
+    {
+        size_t size = next_size;
+        while (size < min_bytes)
+        {
+            size *= 2;
+        }
+
+        void *mem = nullptr;
+        try
+        {
+            mem = ::operator new(sizeof(Block) + size);
+        }
+        catch (const std::bad_alloc &)
+        {
+            throw std::runtime_error("Arena: Allocation failed.");
+        }
+
+        Block *b = static_cast<Block *>(mem);
+        b->prev = current;
+        b->size = size;
+        current = b;
+        ptr = reinterpret_cast<char *>(b + 1);
+        limit = ptr + size;
+        next_size = size * 2; // Geometric growth , same as our Vector
+    }
+
+public:
+    explicit Arena(size_t initial_size = 4096)
+        : current(nullptr), ptr(nullptr), limit(nullptr), next_size(initial_size > 0 ? initial_size : 64)
+    {
+    }
+
+    // An Arena owns raw memory that containers point into , so it can't be copied.
+    Arena(const Arena &) = delete;
+    Arena &operator=(const Arena &) = delete;
+
+    ~Arena()
+    {
+        free_blocks(nullptr);
+    }
+
+    void *allocate(size_t bytes, size_t align = alignof(std::max_align_t))
+    {
+        // Round ptr up to the next multiple of align (align is always a power of 2)
+        uintptr_t p = reinterpret_cast<uintptr_t>(ptr);
+        uintptr_t aligned = (p + align - 1) & ~(uintptr_t)(align - 1);
+
+        if (current == nullptr || aligned + bytes > reinterpret_cast<uintptr_t>(limit))
+        {
+            add_block(bytes + align);
+            p = reinterpret_cast<uintptr_t>(ptr);
+            aligned = (p + align - 1) & ~(uintptr_t)(align - 1);
+        }
+
+        ptr = reinterpret_cast<char *>(aligned + bytes);
+        return reinterpret_cast<void *>(aligned);
+    }
+
+    // Monotonic : giving back single objects is a no-op
+    void deallocate(void *, size_t) noexcept {}
+
+    // Gives back everything at once but keeps the newest (biggest) block for reuse,
+    // so the next round of the same size needs no heap traffic at all.
+    // Every container using this arena must be dead before calling this.
+    void release() noexcept
+    {
+        if (current == nullptr)
+        {
+            return;
+        }
+        Block *keep = current;
+        current = keep->prev;
+        free_blocks(nullptr);
+        keep->prev = nullptr;
+        current = keep;
+        ptr = reinterpret_cast<char *>(keep + 1);
+        limit = ptr + keep->size;
+        next_size = keep->size * 2;
+    }
+
+    // Bytes still free in the current block
+    size_t remaining() const
+    {
+        return limit - ptr;
+    }
+
+private:
+    // Frees every block newer than keep (all of them if keep is nullptr)
+    void free_blocks(Block *keep) noexcept
+    {
+        while (current != nullptr && current != keep)
+        {
+            Block *prev = current->prev;
+            ::operator delete(current);
+            current = prev;
+        }
+    }
+};
+
+// The allocator that containers actually hold.
+// It is just a pointer to an Arena , so copies are cheap and all copies share the same memory.
+// Usage :
+// Arena arena;
+// Vector<int, ArenaAllocator<int>> v(ArenaAllocator<int>(arena));
+template <typename T>
+class ArenaAllocator
+{
+    Arena *arena;
+
+    template <typename U>
+    friend class ArenaAllocator;
+
+public:
+    using value_type = T;
+
+    // Containers must keep using the same arena when they are copied / moved / swapped
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    ArenaAllocator(Arena &a) noexcept : arena(&a) {}
+
+    // Rebinding constructor , a container of T may need an allocator for its internal types (e.g nodes)
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U> &other) noexcept : arena(other.arena) {}
+
+    T *allocate(size_t n)
+    {
+        return static_cast<T *>(arena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T *p, size_t n) noexcept
+    {
+        arena->deallocate(p, n * sizeof(T));
+    }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U> &other) const
+    {
+        return arena == other.arena;
+    }
+
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U> &other) const
+    {
+        return arena != other.arena;
+    }
+};
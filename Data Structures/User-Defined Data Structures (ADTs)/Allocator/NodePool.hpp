@@ -0,0 +1,328 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+
+// Node Pool (Slab Allocator) :
+// Linked structures (List , Stack_real , trees ...) allocate one small node at a time and free it again soon,
+// and plain new / delete pays for that with a general purpose malloc call every time. The nodes also end up
+// scattered all over the heap , so walking a list jumps around memory.
+// A pool only ever hands out blocks of ONE size , which makes it very simple :
+// - memory is taken from the heap in big slabs (64 nodes , then doubling up to 64K nodes per slab),
+// - a new node is the next free slot of the current slab (pointer bump) , so nodes made one after another
+//   sit next to each other in memory,
+// - a freed node is pushed on a free list (the link is stored inside the dead node itself , no extra memory)
+//   and the next allocation pops it : a couple of instructions , no malloc , no free.
+// Slabs go back to the heap only when the pool dies (like Arena , but single nodes CAN be reused).
+class NodePool
+{
+    // Header at the start of every slab , links the slabs together
+    struct Slab
+    {
+        Slab *prev;
+    };
+
+    // A dead node's memory , reused as the free list link
+    struct FreeNode
+    {
+        FreeNode *next;
+    };
+
+    size_t node_size; // Rounded up so every slot is aligned and can hold a FreeNode
+    size_t align;
+    Slab *slabs;
+    char *ptr;   // Next never-used slot in the newest slab
+    char *limit; // End of the newest slab
+    FreeNode *free_list;
+    size_t next_count; // Nodes in the next slab
+
+    static const size_t FIRST_SLAB = 64;
+    static const size_t MAX_SLAB = 64 * 1024;
+
+    // Plain new only promises __STDCPP_DEFAULT_NEW_ALIGNMENT__ (16 on most systems) , more needs the aligned new
+    bool over_aligned() const
+    {
+        return align > __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+    }
+
+    void add_slab()
+    {
+        size_t header = (sizeof(Slab) + align - 1) & ~(align - 1); // Keeps the first slot aligned
+        size_t bytes = header + next_count * node_size;
+        void *mem = nullptr;
+        try
+        {
+            mem = over_aligned() ? ::operator new(bytes, std::align_val_t(align)) : ::operator new(bytes);
+        }
+        catch (const std::bad_alloc &)
+        {
+            throw std::runtime_error("NodePool: Allocation failed.");
+        }
+        Slab *s = static_cast<Slab *>(mem);
+        s->prev = slabs;
+        slabs = s;
+        ptr = static_cast<char *>(mem) + header;
+        limit = ptr + next_count * node_size;
+        if (next_count < MAX_SLAB)
+            next_count *= 2;
+    }
+
+public:
+    explicit NodePool(size_t size, size_t alignment = alignof(std::max_align_t))
+        : slabs(nullptr), ptr(nullptr), limit(nullptr), free_list(nullptr), next_count(FIRST_SLAB)
+    {
+        align = alignment < alignof(FreeNode) ? alignof(FreeNode) : alignment;
+        node_size = size < sizeof(FreeNode) ? sizeof(FreeNode) : size;
+        node_size = (node_size + align - 1) & ~(align - 1);
+    }
+
+    // Nodes point into the slabs , so the pool can't be copied
+    NodePool(const NodePool &) = delete;
+    NodePool &operator=(const NodePool &) = delete;
+
+    ~NodePool()
+    {
+        while (slabs != nullptr)
+        {
+            Slab *prev = slabs->prev;
+            if (over_aligned())
+                ::operator delete(slabs, std::align_val_t(align));
+            else
+                ::operator delete(slabs);
+            slabs = prev;
+        }
+    }
+
+    void *allocate()
+    {
+        if (free_list != nullptr)
+        {
+            FreeNode *n = free_list;
+            free_list = n->next;
+            return n;
+        }
+        if (ptr == limit)
+            add_slab();
+        void *p = ptr;
+        ptr += node_size;
+        return p;
+    }
+
+    void deallocate(void *p) noexcept
+    {
+        FreeNode *n = static_cast<FreeNode *>(p);
+        n->next = free_list;
+        free_list = n;
+    }
+
+    size_t block_size() const { return node_size; }
+    size_t alignment() const { return align; }
+};
+
+// One pool per node size shared by the whole program , with a small cache in every thread.
+// The shared pool needs a lock (many threads) , but a thread first takes nodes from / gives nodes back to
+// its own cache without any lock , and only moves BATCH nodes at a time to or from the shared pool.
+// So a thread that keeps pushing and popping never touches the lock at all.
+// The shared pool is never destroyed on purpose : a global List may free its nodes after every other static
+// object is gone , and the OS takes the memory back at exit anyway.
+template <size_t Size, size_t Align>
+class SharedNodePool
+{
+    struct FreeNode
+    {
+        FreeNode *next;
+    };
+
+    struct Central
+    {
+        std::mutex lock;
+        NodePool pool{Size, Align};
+    };
+
+    static Central &central()
+    {
+        static Central *c = new Central; // Never deleted (see above)
+        return *c;
+    }
+
+    static const size_t BATCH = 64;
+
+    struct Cache
+    {
+        FreeNode *list = nullptr;
+        size_t count = 0;
+
+        ~Cache()
+        {
+            // Thread is ending : its cached nodes go back for other threads , and from now on
+            // this thread uses the shared pool directly
+            cache_gone() = true;
+            give_back(*this, count);
+        }
+    };
+
+    static Cache &cache()
+    {
+        thread_local Cache c;
+        return c;
+    }
+
+    // true once this thread's Cache has been destroyed. Nodes can still be freed after that : a global List
+    // dies after main's thread_locals , a thread_local List may die after the Cache. The Cache itself must not be
+    // touched then (it is gone) , so the flag lives apart from it : a plain bool has no destructor , it stays
+    // readable until the thread's storage is released.
+    static bool &cache_gone()
+    {
+        thread_local bool gone = false;
+        return gone;
+    }
+
+    // Without a cache : straight to the shared pool , under its lock
+    static void *allocate_shared()
+    {
+        Central &shared = central();
+        std::lock_guard<std::mutex> guard(shared.lock);
+        return shared.pool.allocate();
+    }
+
+    // Moves n nodes from cache c to the shared pool
+    static void give_back(Cache &c, size_t n)
+    {
+        Central &shared = central();
+        std::lock_guard<std::mutex> guard(shared.lock);
+        for (size_t i = 0; i < n && c.list != nullptr; i++)
+        {
+            FreeNode *node = c.list;
+            c.list = node->next;
+            c.count--;
+            shared.pool.deallocate(node);
+        }
+    }
+
+public:
+    static void *allocate()
+    {
+        if (cache_gone())
+            return allocate_shared();
+        Cache &c = cache();
+        if (c.list == nullptr)
+        {
+            // Refill : BATCH nodes , one after another in memory when they come from a fresh slab
+            Central &shared = central();
+            std::lock_guard<std::mutex> guard(shared.lock);
+            FreeNode *batch[BATCH];
+            for (size_t i = 0; i < BATCH; i++)
+                batch[i] = static_cast<FreeNode *>(shared.pool.allocate());
+            for (size_t i = BATCH; i-- > 0;) // Pushed backwards so they pop out in address order
+            {
+                batch[i]->next = c.list;
+                c.list = batch[i];
+            }
+            c.count = BATCH;
+        }
+        FreeNode *n = c.list;
+        c.list = n->next;
+        c.count--;
+        return n;
+    }
+
+    static void deallocate(void *p) noexcept
+    {
+        if (cache_gone())
+        {
+            Central &shared = central();
+            std::lock_guard<std::mutex> guard(shared.lock);
+            shared.pool.deallocate(p);
+            return;
+        }
+        Cache &c = cache();
+        FreeNode *n = static_cast<FreeNode *>(p);
+        n->next = c.list;
+        c.list = n;
+        if (++c.count > 2 * BATCH)
+            give_back(c, BATCH); // Don't let one thread hoard what another thread needs
+    }
+};
+
+// The allocator containers hold (std::allocator compatible , so it goes through std::allocator_traits).
+// Single objects (n == 1 , what node based containers ask for) come from a pool , arrays go to new / delete.
+// - PoolAllocator<T>()     : the shared pool for objects of T's size , with per thread caches (the default for List).
+// - PoolAllocator<T>(pool) : your own NodePool , no locking at all , e.g one pool per list so that list's nodes
+//                            stay together. The pool must outlive every container using it (same rule as Arena).
+// Usage :
+// NodePool pool(sizeof(Node<int>), alignof(Node<int>));
+// List<int, PoolAllocator<int>> l(PoolAllocator<int>(pool));
+template <typename T>
+class PoolAllocator
+{
+    NodePool *pool; // nullptr : the shared pool
+
+    template <typename U>
+    friend class PoolAllocator;
+
+public:
+    using value_type = T;
+
+    // A container keeps its own pool when copied / assigned (like std::allocator)
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    PoolAllocator() noexcept : pool(nullptr) {}
+    explicit PoolAllocator(NodePool &p) noexcept : pool(&p) {}
+
+    // Rebinding constructor : List<T> asks for Node<T> objects , not T
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U> &other) noexcept : pool(other.pool) {}
+
+    T *allocate(size_t n)
+    {
+        if (n != 1)
+        {
+            if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+                return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+            else
+                return static_cast<T *>(::operator new(n * sizeof(T)));
+        }
+        if (pool != nullptr)
+        {
+            if (pool->block_size() < sizeof(T))
+                throw std::invalid_argument("PoolAllocator: Pool blocks are too small for this type.");
+            if (pool->alignment() < alignof(T))
+                throw std::invalid_argument("PoolAllocator: Pool blocks are not aligned enough for this type.");
+            return static_cast<T *>(pool->allocate());
+        }
+        return static_cast<T *>(SharedNodePool<sizeof(T), alignof(T)>::allocate());
+    }
+
+    void deallocate(T *p, size_t n) noexcept
+    {
+        if (n != 1)
+        {
+            if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+                ::operator delete(p, std::align_val_t(alignof(T)));
+            else
+                ::operator delete(p);
+        }
+        else if (pool != nullptr)
+            pool->deallocate(p);
+        else
+            SharedNodePool<sizeof(T), alignof(T)>::deallocate(p);
+    }
+
+    // Equal allocators can free each other's memory (this is what join / splice needs)
+    template <typename U>
+    bool operator==(const PoolAllocator<U> &other) const
+    {
+        return pool == other.pool;
+    }
+
+    template <typename U>
+    bool operator!=(const PoolAllocator<U> &other) const
+    {
+        return pool != other.pool;
+    }
+};
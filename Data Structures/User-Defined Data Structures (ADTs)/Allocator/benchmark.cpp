@@ -0,0 +1,100 @@
+#include "Arena.hpp"
+#include "../Vector/Vector.hpp"
+#include "../Stack/Stack.hpp"
+#include "../String/ADT/String.hpp"
+#include <iostream>
+#include <chrono>
+
+// Allocation cost of short-lived containers : std::allocator (new / delete) vs ArenaAllocator.
+// Every round builds a small container , fills it and lets it die , like per request data in a service.
+// The arena is released once every 1000 rounds (end of a "request batch").
+// g++ -std=c++17 -O2 benchmark.cpp -o benchmark
+
+using Clock = std::chrono::steady_clock;
+
+const int ROUNDS = 1000000;
+const int BATCH = 1000;
+const int ITEMS = 32;
+
+double ms_since(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// Defeats the optimizer so the containers are really built
+volatile long long sink = 0;
+
+template <typename A>
+double vector_rounds(const A &a, Arena *arena)
+{
+    auto start = Clock::now();
+    for (int r = 0; r < ROUNDS; r++)
+    {
+        {
+            Vector<int, A> v(a);
+            for (int i = 0; i < ITEMS; i++)
+                v.push_back(i);
+            sink = sink + v[ITEMS - 1];
+        }
+        if (arena != nullptr && r % BATCH == BATCH - 1)
+            arena->release();
+    }
+    return ms_since(start);
+}
+
+template <typename A>
+double stack_rounds(const A &a, Arena *arena)
+{
+    auto start = Clock::now();
+    for (int r = 0; r < ROUNDS; r++)
+    {
+        {
+            Stack<int, A> s(a);
+            for (int i = 0; i < ITEMS; i++)
+                s.push(i);
+            sink = sink + s.top();
+        }
+        if (arena != nullptr && r % BATCH == BATCH - 1)
+            arena->release();
+    }
+    return ms_since(start);
+}
+
+template <typename A>
+double string_rounds(const A &a, Arena *arena)
+{
+    auto start = Clock::now();
+    for (int r = 0; r < ROUNDS; r++)
+    {
+        {
+            BasicString<A> s(a);
+            for (int i = 0; i < ITEMS * 2; i++)
+                s.push_back('a' + i % 26);
+            sink = sink + s.size();
+        }
+        if (arena != nullptr && r % BATCH == BATCH - 1)
+            arena->release();
+    }
+    return ms_since(start);
+}
+
+int main()
+{
+    Arena arena(64 * 1024);
+
+    std::cout << ROUNDS << " short-lived containers , " << ITEMS << " pushes each" << std::endl;
+
+    std::cout << "Vector<int> : std::allocator "
+              << vector_rounds(std::allocator<int>(), nullptr) << " ms | arena "
+              << vector_rounds(ArenaAllocator<int>(arena), &arena) << " ms" << std::endl;
+
+    std::cout << "Stack<int>  : std::allocator "
+              << stack_rounds(std::allocator<int>(), nullptr) << " ms | arena "
+              << stack_rounds(ArenaAllocator<int>(arena), &arena) << " ms" << std::endl;
+
+    std::cout << "String      : std::allocator "
+              << string_rounds(std::allocator<char>(), nullptr) << " ms | arena "
+              << string_rounds(ArenaAllocator<char>(arena), &arena) << " ms" << std::endl;
+
+    return 0;
+}
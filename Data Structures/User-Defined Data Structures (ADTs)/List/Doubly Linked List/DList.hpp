@@ -0,0 +1,455 @@
+#pragma once
+#include <iostream>
+#include <memory>
+#include "../../Allocator/NodePool.hpp"
+
+using namespace std;
+
+// Doubly Linked List : same functions as List<T> in "../Singly Linked List" , but every node also knows the node BEFORE it.
+// What that buys :
+// - pop_back_list() is O(1) : the singly list has to walk from head to find the node before tail , here it is tail->prev
+// - remove_node(size-1) and removing at a known position (an Iterator) are O(1)
+// - Iterators go backwards too (--it) , and index based functions walk from whichever end is nearer
+// The cost is one more pointer per node and two more links to fix on every insert / remove.
+// Nodes come from PoolAllocator by default , exactly like List<T>.
+template <typename T>
+class DNode
+{
+public:
+    T val;
+    DNode<T>* prev;
+    DNode<T>* next;
+    DNode(const T& v = T(), DNode<T>* p = nullptr, DNode<T>* n = nullptr) : val(v), prev(p), next(n) {}
+};
+
+template <typename T, typename Alloc = PoolAllocator<T>>
+class DList
+{
+    using NodeAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<DNode<T>>;
+    using traits = std::allocator_traits<NodeAlloc>;
+
+    DNode<T>* head;
+    DNode<T>* tail;
+    [[no_unique_address]] NodeAlloc alloc;
+
+    DNode<T>* new_node(const T& val, DNode<T>* p, DNode<T>* n)
+    {
+        DNode<T>* node = traits::allocate(alloc, 1);
+        try
+        {
+            traits::construct(alloc, node, val, p, n);
+        }
+        catch (...)
+        {
+            traits::deallocate(alloc, node, 1);   //T's copy threw , give the memory back
+            throw;
+        }
+        return node;
+    }
+
+    void free_node(DNode<T>* p)
+    {
+        traits::destroy(alloc, p);
+        traits::deallocate(alloc, p, 1);
+    }
+
+    // Node at index ind (0 <= ind < size) , walking from the nearer end
+    DNode<T>* node_at(int ind) const
+    {
+        DNode<T>* temp;
+        if (ind < size / 2)
+        {
+            temp = head;
+            for (int i = 0; i < ind; i++)
+            {
+                temp = temp->next;
+            }
+        }
+        else
+        {
+            temp = tail;
+            for (int i = size - 1; i > ind; i--)
+            {
+                temp = temp->prev;
+            }
+        }
+        return temp;
+    }
+
+    // Puts a new node before pos (pos == nullptr means at the end) , O(1)
+    DNode<T>* link_before(DNode<T>* pos, const T& val)
+    {
+        DNode<T>* before = (pos == nullptr) ? tail : pos->prev;
+        DNode<T>* newNode = new_node(val, before, pos);
+        if (before == nullptr)
+        {
+            head = newNode;
+        }
+        else
+        {
+            before->next = newNode;
+        }
+        if (pos == nullptr)
+        {
+            tail = newNode;
+        }
+        else
+        {
+            pos->prev = newNode;
+        }
+        size++;
+        return newNode;
+    }
+
+    // Takes node out of the list and frees it , O(1). Returns the node after it.
+    DNode<T>* unlink(DNode<T>* node)
+    {
+        DNode<T>* after = node->next;
+        if (node->prev == nullptr)
+        {
+            head = after;
+        }
+        else
+        {
+            node->prev->next = after;
+        }
+        if (after == nullptr)
+        {
+            tail = node->prev;
+        }
+        else
+        {
+            after->prev = node->prev;
+        }
+        free_node(node);
+        size--;
+        return after;
+    }
+
+public:
+    int size = 0;
+
+    DList()
+    {
+        head = nullptr;
+        tail = nullptr;
+        size = 0;
+    }
+    explicit DList(const Alloc& a) : alloc(a)
+    {
+        head = nullptr;
+        tail = nullptr;
+        size = 0;
+    }
+
+    void push_front_list(const T& val)
+    {
+        link_before(head, val);
+    }
+
+    void push_back_list(const T& val)
+    {
+        link_before(nullptr, val);
+    }
+
+    void pop_front_list()
+    {
+        if (head == nullptr)
+        {
+            cout << "List is empty " << endl;
+            return;
+        }
+        unlink(head);
+    }
+
+    // No walk needed : tail->prev is the new tail
+    void pop_back_list()
+    {
+        if (head == nullptr)
+        {
+            cout << "List is empty " << endl;
+            return;
+        }
+        unlink(tail);
+    }
+
+    void insert_node(const T& val, int ind)
+    {
+        if (ind < 0 || ind > size)
+        {
+            cout << "Invalid Index " << endl;
+            return;
+        }
+        link_before(ind == size ? nullptr : node_at(ind), val);
+    }
+
+    void remove_node_val(const T& val)
+    {
+        DNode<T>* temp = head;
+        while (temp != nullptr)
+        {
+            if (temp->val == val)
+            {
+                temp = unlink(temp);
+            }
+            else
+            {
+                temp = temp->next;
+            }
+        }
+    }
+
+    void remove_node(int ind)
+    {
+        if (ind < 0 || ind >= size)
+        {
+            cout << "Invalid Size " << endl;
+            return;
+        }
+        unlink(node_at(ind));
+    }
+
+    int linear_search(const T& target) const //Returns Index
+    {
+        int ind = 0;
+        for (DNode<T>* temp = head; temp != nullptr; temp = temp->next)
+        {
+            if (temp->val == target)
+            {
+                return ind;
+            }
+            ind++;
+        }
+        return -1;
+    }
+
+    T at_list(int ind) const
+    {
+        if (ind < 0 || ind >= size)
+        {
+            cout << "Invalid Position " << endl;
+            return T();
+        }
+        return node_at(ind)->val;
+    }
+
+    //Using Selection Sort on List (same as List<T>) :
+    void selectionSort()
+    {
+        for (DNode<T>* current = head; current != nullptr; current = current->next)
+        {
+            DNode<T>* minNode = current;
+            for (DNode<T>* temp = current->next; temp != nullptr; temp = temp->next)
+            {
+                if (temp->val < minNode->val)
+                {
+                    minNode = temp;
+                }
+            }
+            if (minNode != current)
+            {
+                std::swap(current->val, minNode->val);
+            }
+        }
+    }
+
+    void print_list() const
+    {
+        for (DNode<T>* temp = head; temp != nullptr; temp = temp->next)
+        {
+            cout << temp->val << " ";
+        }
+        cout << endl;
+    }
+
+    // Printing backwards is as cheap as forwards
+    void print_reverse() const
+    {
+        for (DNode<T>* temp = tail; temp != nullptr; temp = temp->prev)
+        {
+            cout << temp->val << " ";
+        }
+        cout << endl;
+    }
+
+    void clear_list()
+    {
+        DNode<T>* temp = head;
+        while (temp != nullptr)
+        {
+            DNode<T>* nextNode = temp->next;
+            free_node(temp);
+            temp = nextNode;
+        }
+        head = tail = nullptr;
+        size = 0;
+    }
+
+    ~DList()
+    {
+        clear_list();
+    }
+
+    DList(const DList& other) : alloc(traits::select_on_container_copy_construction(other.alloc))
+    {
+        head = tail = nullptr;
+        size = 0;
+        append(other);
+    }
+
+    DList& operator=(const DList& other)
+    {
+        if (this != &other)
+        {
+            clear_list();
+            append(other);
+        }
+        return *this;
+    }
+
+    friend ostream& operator << (ostream &out, const DList& list)
+    {
+        for (DNode<T>* temp = list.head; temp != nullptr; temp = temp->next)
+            out << temp->val << ' ';
+        out << '\n';
+        return out;
+    }
+
+    T& operator[](int index)
+    {
+        if (index < 0 || index >= size)
+        {
+            cout << "Invalid Index " << endl;
+        }
+        return node_at(index)->val;
+    }
+
+    bool operator==(const DList& other) const
+    {
+        if (size != other.size)
+        {
+            return false;
+        }
+        for (DNode<T> *a = head, *b = other.head; a != nullptr; a = a->next, b = b->next)
+        {
+            if (a->val != b->val)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void append(const DList& other)  //Copy the appending list
+    {
+        int n = other.size; // Stays right even for l.append(l)
+        DNode<T>* temp = other.head;
+        for (int i = 0; i < n; i++, temp = temp->next)
+        {
+            push_back_list(temp->val);
+        }
+    }
+
+    void join(DList& other)  //Like std::list::splice : moves all of other's nodes here in O(1) , other becomes empty
+    {
+        if (other.head == nullptr || &other == this)
+        {
+            return;
+        }
+        if (alloc != other.alloc)    // Different pools : our allocator can't free other's nodes , so copy
+        {
+            append(other);
+            other.clear_list();
+            return;
+        }
+        if (head == nullptr)
+        {
+            head = other.head;
+        }
+        else
+        {
+            tail->next = other.head;
+            other.head->prev = tail;
+        }
+        tail = other.tail;
+        size += other.size;
+        other.head = other.tail = nullptr;
+        other.size = 0;
+    }
+
+    //Bidirectional Iterator (nested class) : ++ and -- , and --end() is the last element
+    class Iterator
+    {
+        DNode<T>* ptr;        //Points to current Node , nullptr for end()
+        const DList* owner;   //Needed so --end() can find tail
+
+        friend class DList;
+    public:
+        Iterator(DNode<T>* p = nullptr, const DList* o = nullptr) : ptr(p), owner(o) {}
+        T& operator*()
+        {
+            return (ptr->val);
+        }
+        T* operator->()
+        {
+            return &(ptr->val);
+        }
+        Iterator& operator++()
+        {
+            ptr = ptr->next;
+            return (*this);
+        }
+        Iterator operator++(int)
+        {
+            Iterator temp = *this;
+            ptr = ptr->next;
+            return temp;
+        }
+        Iterator& operator--()
+        {
+            ptr = (ptr == nullptr) ? owner->tail : ptr->prev;
+            return (*this);
+        }
+        Iterator operator--(int)
+        {
+            Iterator temp = *this;
+            --(*this);
+            return temp;
+        }
+        bool operator==(const Iterator& it) const
+        {
+            return (ptr == it.ptr);
+        }
+        bool operator!=(const Iterator& it) const
+        {
+            return (ptr != it.ptr);
+        }
+    };
+
+    Iterator begin()
+    {
+        return Iterator(head, this);
+    }
+    Iterator end()
+    {
+        return Iterator(nullptr, this);
+    }
+
+    // O(1) removal at an iterator (no search for the node before it). Returns the iterator after the removed one.
+    // it must point to an element : end() has nothing to remove.
+    Iterator erase(Iterator it)
+    {
+        if (it.ptr == nullptr)
+        {
+            cout << "Invalid Position " << endl;
+            return end();
+        }
+        return Iterator(unlink(it.ptr), this);
+    }
+
+    // O(1) insertion before an iterator (end() inserts at the back). Returns the iterator to the new element.
+    Iterator insert(Iterator it, const T& val)
+    {
+        return Iterator(link_before(it.ptr, val), this);
+    }
+};
@@ -0,0 +1,93 @@
+#include "DList.hpp"
+#include "../Singly Linked List/Templated List using 2 Classes (Basic Functions) + Nested Iterator Class/Singly_List.hpp"
+#include <chrono>
+
+// Benchmarks for DList.hpp
+// Compile with optimizations on , otherwise the numbers mean nothing :
+// g++ -std=c++17 -O2 -pthread benchmark.cpp -o benchmark
+
+using Clock = std::chrono::steady_clock;
+
+double ms_since(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// Defeats the optimizer so the lists are really built
+volatile long long sink = 0;
+
+// Fills l with n values and times popping all of them from the back
+template <typename L>
+double pop_back_all(L &l, int n)
+{
+    for (int i = 0; i < n; i++)
+        l.push_back_list(i);
+    auto start = Clock::now();
+    while (l.size > 0)
+        l.pop_back_list();
+    double ms = ms_since(start);
+    sink = sink + l.size;
+    return ms;
+}
+
+// --- 1. pop_back : singly List walks to the node before tail , DList uses tail->prev ---
+void bench_pop_back()
+{
+    std::cout << "--- 1. pop_back_list until empty ---" << std::endl;
+    for (int n : {1000, 10000, 50000})
+    {
+        List<int> singly;
+        DList<int> doubly;
+        double s = pop_back_all(singly, n);
+        double d = pop_back_all(doubly, n);
+        std::cout << n << " elements : List " << s << " ms | DList " << d << " ms (" << n / d / 1000
+                  << " M pops/s , " << s / d << "x)" << std::endl;
+    }
+    // The singly list is O(n^2) here , only DList can run the big case
+    DList<int> big;
+    int n = 10000000;
+    double d = pop_back_all(big, n);
+    std::cout << n << " elements : DList " << d << " ms (" << n / d / 1000 << " M pops/s)" << std::endl;
+    std::cout << std::endl;
+}
+
+// --- 2. Deque use : push at both ends , pop at both ends ---
+template <typename L>
+double deque_mix(int steps)
+{
+    L l;
+    for (int i = 0; i < 1000; i++)
+        l.push_back_list(i);
+    auto start = Clock::now();
+    for (int i = 0; i < steps; i++)
+    {
+        if (i & 1)
+        {
+            l.push_front_list(i);
+            l.pop_back_list();
+        }
+        else
+        {
+            l.push_back_list(i);
+            l.pop_front_list();
+        }
+    }
+    double ms = ms_since(start);
+    sink = sink + l.size;
+    return ms;
+}
+
+void bench_deque()
+{
+    std::cout << "--- 2. Deque use , 1000 elements , push + pop at alternating ends ---" << std::endl;
+    std::cout << "200000 steps : List " << deque_mix<List<int>>(200000) << " ms | DList " << deque_mix<DList<int>>(200000)
+              << " ms" << std::endl;
+    std::cout << std::endl;
+}
+
+int main()
+{
+    bench_pop_back();
+    bench_deque();
+    return 0;
+}
@@ -0,0 +1,53 @@
+#include <iostream>
+#include <string>
+#include "DList.hpp"
+
+using namespace std;
+
+int main()
+{
+    DList<string> l1;
+
+    l1.push_back_list("banana");
+    l1.push_back_list("apple");
+    l1.push_back_list("cherry");
+    l1.push_front_list("Avocado");
+    l1.insert_node("Zebra", 2);
+    cout << l1;                     // Avocado banana Zebra apple cherry
+
+    l1.pop_back_list();             // O(1) , no walk to find the node before tail
+    l1.print_reverse();             // apple Zebra banana Avocado
+
+    //Walking backwards with --
+    for (DList<string>::Iterator it = l1.end(); it != l1.begin();)
+    {
+        --it;
+        cout << *it << " ";
+    }
+    cout << endl;
+
+    //O(1) removal through an iterator : remove every name starting with a capital letter
+    for (DList<string>::Iterator it = l1.begin(); it != l1.end();)
+    {
+        if ((*it)[0] >= 'A' && (*it)[0] <= 'Z')
+            it = l1.erase(it);
+        else
+            ++it;
+    }
+    cout << l1;                     // banana apple
+
+    DList<string> l2;
+    l2.push_back_list("kiwi");
+    l2.push_back_list("fig");
+    l1.join(l2);                    // O(1) , l2 is now empty
+    cout << l1 << l2.size << endl;  // banana apple kiwi fig , 0
+
+    //For-Range Based loop
+    l1.selectionSort();
+    for (string c : l1)
+    {
+        cout << c << " ";
+    }
+    cout << endl;
+    return 0;
+}
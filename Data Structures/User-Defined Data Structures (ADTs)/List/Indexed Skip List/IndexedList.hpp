@@ -0,0 +1,510 @@
+#pragma once
+#include <iostream>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include "../../Allocator/NodePool.hpp"
+
+using namespace std;
+
+// Indexable Skip List : the List<T> functions , but l[i] , at_list , insert_node and remove_node by index
+// are O(log n) instead of walking i nodes from head. So the common loop
+// for (int i = 0; i < l.size; i++) ... l[i] ...
+// is O(n log n) here , and O(n^2) on List<T>.
+// How : every node is on level 0 (a normal linked list , which is what iteration walks) and ALSO on a few
+// "express" levels above it. A node is on level 1 with chance 1/4 , on level 2 with chance 1/16 and so on,
+// so each level skips about 4 nodes of the level below. Every link also stores its WIDTH : how many level 0
+// nodes it jumps over. Finding index i starts on the top level and moves right while the widths added up
+// stay <= i , then drops a level : about 4 steps per level and log4(n) levels.
+// Inserting or removing only fixes the links (and widths) that pass over that position , O(log n) of them.
+// Memory : on average 1.33 links per node (vs 1 in List<T>) , plus the widths.
+// Nodes have different sizes (their height) , so there is no Alloc parameter : see new_node.
+template <typename T>
+class IndexedList
+{
+    static const int MAX_LEVEL = 20;   // 4^20 elements , far more than an int size can count
+
+    struct SNode;
+
+    struct Link
+    {
+        SNode* next;
+        int width;   // Level 0 steps from this node to next (only meaningful when next != nullptr)
+    };
+
+    // Allocated as one block : the node , then height Links right after it
+    struct SNode
+    {
+        size_t height;   // size_t first keeps the Links after the node 8 byte aligned
+        T val;
+
+        SNode(const T& v, size_t h) : height(h), val(v) {}
+        Link* links()
+        {
+            return reinterpret_cast<Link*>(this + 1);
+        }
+    };
+
+    Link head[MAX_LEVEL];   // The links that start before the first element (position -1)
+    int levels;             // Levels in use (1 .. MAX_LEVEL)
+    uint64_t seed;
+
+    // 1 + (number of times a 1 in 4 chance came up in a row)
+    int random_height()
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        int h = 1;
+        uint64_t bits = seed;
+        while ((bits & 3) == 0 && h < MAX_LEVEL)
+        {
+            h++;
+            bits >>= 2;
+        }
+        return h;
+    }
+
+    // Heights 1 and 2 (15 of every 16 nodes) have a fixed size , so they come from the shared node pool
+    // like List<T>'s nodes. Taller nodes are rare and go to new / delete.
+    using Pool1 = SharedNodePool<sizeof(SNode) + 1 * sizeof(Link), alignof(SNode)>;
+    using Pool2 = SharedNodePool<sizeof(SNode) + 2 * sizeof(Link), alignof(SNode)>;
+
+    static void* raw_allocate(int h)
+    {
+        if (h == 1)
+            return Pool1::allocate();
+        if (h == 2)
+            return Pool2::allocate();
+        try
+        {
+            return ::operator new(sizeof(SNode) + h * sizeof(Link));
+        }
+        catch (const std::bad_alloc&)
+        {
+            throw std::runtime_error("IndexedList: Allocation failed.");
+        }
+    }
+
+    static void raw_deallocate(void* p, size_t h) noexcept
+    {
+        if (h == 1)
+            Pool1::deallocate(p);
+        else if (h == 2)
+            Pool2::deallocate(p);
+        else
+            ::operator delete(p);
+    }
+
+    SNode* new_node(const T& val, int h)
+    {
+        void* mem = raw_allocate(h);
+        try
+        {
+            return ::new (mem) SNode(val, h);
+        }
+        catch (...)
+        {
+            raw_deallocate(mem, h);   //T's copy threw
+            throw;
+        }
+    }
+
+    static void free_node(SNode* p)
+    {
+        size_t h = p->height;
+        p->~SNode();
+        raw_deallocate(p, h);
+    }
+
+    Link* links_of(SNode* x)
+    {
+        return x == nullptr ? head : x->links();
+    }
+
+    // For every level : the last node (nullptr = head) whose position is < ind , and that position
+    void find_before(int ind, SNode** update, int* pos)
+    {
+        SNode* x = nullptr;
+        int p = -1;
+        for (int lvl = levels - 1; lvl >= 0; lvl--)
+        {
+            Link* l = links_of(x);
+            while (l[lvl].next != nullptr && p + l[lvl].width < ind)
+            {
+                p += l[lvl].width;
+                x = l[lvl].next;
+                l = x->links();
+            }
+            update[lvl] = x;
+            pos[lvl] = p;
+        }
+    }
+
+    SNode* node_at(int ind)
+    {
+        SNode* x = nullptr;
+        int p = -1;
+        for (int lvl = levels - 1; lvl >= 0; lvl--)
+        {
+            Link* l = links_of(x);
+            while (l[lvl].next != nullptr && p + l[lvl].width <= ind)
+            {
+                p += l[lvl].width;
+                x = l[lvl].next;
+                l = x->links();
+            }
+            if (p == ind)
+            {
+                return x;
+            }
+        }
+        return x;
+    }
+
+    void insert_at(const T& val, int ind)
+    {
+        SNode* update[MAX_LEVEL] = {};
+        int pos[MAX_LEVEL];
+        find_before(ind, update, pos);
+
+        int h = random_height();
+        SNode* n = new_node(val, h);
+        Link* nl = n->links();
+        for (int lvl = levels; lvl < h; lvl++)   // New levels start at head
+        {
+            update[lvl] = nullptr;
+            pos[lvl] = -1;
+            head[lvl].next = nullptr;
+        }
+        if (h > levels)
+        {
+            levels = h;
+        }
+
+        for (int lvl = 0; lvl < levels; lvl++)
+        {
+            Link& before = links_of(update[lvl])[lvl];
+            if (lvl < h)
+            {
+                // before -> n -> (what before pointed to , which moved one position right)
+                nl[lvl].next = before.next;
+                nl[lvl].width = before.next != nullptr ? pos[lvl] + before.width + 1 - ind : 0;
+                before.next = n;
+                before.width = ind - pos[lvl];
+            }
+            else if (before.next != nullptr)
+            {
+                before.width++;   // This link now jumps over one more node
+            }
+        }
+        size++;
+    }
+
+    void remove_at(int ind)
+    {
+        SNode* update[MAX_LEVEL] = {};
+        int pos[MAX_LEVEL];
+        find_before(ind, update, pos);
+        SNode* target = links_of(update[0])[0].next;
+        Link* tl = target->links();
+
+        for (int lvl = 0; lvl < levels; lvl++)
+        {
+            Link& before = links_of(update[lvl])[lvl];
+            if (before.next == target)
+            {
+                before.width = tl[lvl].next != nullptr ? before.width + tl[lvl].width - 1 : 0;
+                before.next = tl[lvl].next;
+            }
+            else if (before.next != nullptr)
+            {
+                before.width--;
+            }
+        }
+        while (levels > 1 && head[levels - 1].next == nullptr)
+        {
+            levels--;
+        }
+        free_node(target);
+        size--;
+    }
+
+public:
+    int size = 0;
+
+    IndexedList() : levels(1), seed(0x9E3779B97F4A7C15ULL)
+    {
+        for (int lvl = 0; lvl < MAX_LEVEL; lvl++)
+        {
+            head[lvl].next = nullptr;
+            head[lvl].width = 0;
+        }
+        size = 0;
+    }
+
+    void push_front_list(const T& val)
+    {
+        insert_at(val, 0);
+    }
+
+    void push_back_list(const T& val)
+    {
+        insert_at(val, size);
+    }
+
+    void pop_front_list()
+    {
+        if (size == 0)
+        {
+            cout << "List is empty " << endl;
+            return;
+        }
+        remove_at(0);
+    }
+
+    // O(log n) , no walk from head
+    void pop_back_list()
+    {
+        if (size == 0)
+        {
+            cout << "List is empty " << endl;
+            return;
+        }
+        remove_at(size - 1);
+    }
+
+    void insert_node(const T& val, int ind)
+    {
+        if (ind < 0 || ind > size)
+        {
+            cout << "Invalid Index " << endl;
+            return;
+        }
+        insert_at(val, ind);
+    }
+
+    void remove_node(int ind)
+    {
+        if (ind < 0 || ind >= size)
+        {
+            cout << "Invalid Size " << endl;
+            return;
+        }
+        remove_at(ind);
+    }
+
+    // One pass over level 0 : for every level we remember the last node still on it , that is the link to fix
+    void remove_node_val(const T& val)
+    {
+        Link* last[MAX_LEVEL];
+        for (int lvl = 0; lvl < levels; lvl++)
+        {
+            last[lvl] = &head[lvl];
+        }
+        SNode* x = head[0].next;
+        while (x != nullptr)
+        {
+            Link* xl = x->links();
+            SNode* after = xl[0].next;
+            int h = (int)x->height;
+            if (x->val == val)
+            {
+                for (int lvl = 0; lvl < levels; lvl++)
+                {
+                    Link& before = *last[lvl];
+                    if (lvl < h)
+                    {
+                        before.width = xl[lvl].next != nullptr ? before.width + xl[lvl].width - 1 : 0;
+                        before.next = xl[lvl].next;
+                    }
+                    else if (before.next != nullptr)
+                    {
+                        before.width--;
+                    }
+                }
+                free_node(x);
+                size--;
+            }
+            else
+            {
+                for (int lvl = 0; lvl < h; lvl++)
+                {
+                    last[lvl] = &xl[lvl];
+                }
+            }
+            x = after;
+        }
+        while (levels > 1 && head[levels - 1].next == nullptr)
+        {
+            levels--;
+        }
+    }
+
+    int linear_search(const T& target) const //Returns Index
+    {
+        int ind = 0;
+        for (SNode* x = head[0].next; x != nullptr; x = x->links()[0].next)
+        {
+            if (x->val == target)
+            {
+                return ind;
+            }
+            ind++;
+        }
+        return -1;
+    }
+
+    T at_list(int ind)
+    {
+        if (ind < 0 || ind >= size)
+        {
+            cout << "Invalid Position " << endl;
+            return T();
+        }
+        return node_at(ind)->val;
+    }
+
+    T& operator[](int index)
+    {
+        if (index < 0 || index >= size)
+        {
+            cout << "Invalid Index " << endl;
+        }
+        return node_at(index)->val;
+    }
+
+    void print_list() const
+    {
+        cout << *this;
+    }
+
+    void clear_list()
+    {
+        SNode* x = head[0].next;
+        while (x != nullptr)
+        {
+            SNode* after = x->links()[0].next;
+            free_node(x);
+            x = after;
+        }
+        for (int lvl = 0; lvl < MAX_LEVEL; lvl++)
+        {
+            head[lvl].next = nullptr;
+            head[lvl].width = 0;
+        }
+        levels = 1;
+        size = 0;
+    }
+
+    ~IndexedList()
+    {
+        clear_list();
+    }
+
+    IndexedList(const IndexedList& other) : IndexedList()
+    {
+        append(other);
+    }
+
+    IndexedList& operator=(const IndexedList& other)
+    {
+        if (this != &other)
+        {
+            clear_list();
+            append(other);
+        }
+        return *this;
+    }
+
+    friend ostream& operator << (ostream &out, const IndexedList& list)
+    {
+        for (SNode* x = list.head[0].next; x != nullptr; x = x->links()[0].next)
+            out << x->val << ' ';
+        out << '\n';
+        return out;
+    }
+
+    bool operator==(const IndexedList& other) const
+    {
+        if (size != other.size)
+        {
+            return false;
+        }
+        for (SNode *a = head[0].next, *b = other.head[0].next; a != nullptr; a = a->links()[0].next, b = b->links()[0].next)
+        {
+            if (a->val != b->val)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void append(const IndexedList& other)  //Copy the appending list
+    {
+        int n = other.size;   // Stays right even for l.append(l)
+        SNode* x = other.head[0].next;
+        for (int i = 0; i < n; i++, x = x->links()[0].next)
+        {
+            push_back_list(x->val);
+        }
+    }
+
+    //Moves other's elements to our back , other becomes empty.
+    //The express levels of both lists would have to be re-measured anyway , so this is append + clear : O(m log n).
+    void join(IndexedList& other)
+    {
+        if (&other == this)
+        {
+            return;
+        }
+        append(other);
+        other.clear_list();
+    }
+
+    //Iterator (nested class) : walks level 0 , exactly like List<T>'s Iterator
+    class Iterator
+    {
+        SNode* ptr;
+    public:
+        Iterator(SNode* p = nullptr) : ptr(p) {}
+        T& operator*()
+        {
+            return (ptr->val);
+        }
+        T* operator->()
+        {
+            return &(ptr->val);
+        }
+        Iterator& operator++()
+        {
+            ptr = ptr->links()[0].next;
+            return (*this);
+        }
+        Iterator operator++(int)
+        {
+            Iterator temp = *this;
+            ptr = ptr->links()[0].next;
+            return temp;
+        }
+        bool operator==(const Iterator& it) const
+        {
+            return (ptr == it.ptr);
+        }
+        bool operator!=(const Iterator& it) const
+        {
+            return (ptr != it.ptr);
+        }
+    };
+
+    Iterator begin()
+    {
+        return Iterator(head[0].next);
+    }
+    Iterator end()
+    {
+        return Iterator(nullptr);
+    }
+};
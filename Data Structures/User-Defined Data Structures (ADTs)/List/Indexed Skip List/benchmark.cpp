@@ -0,0 +1,77 @@
+#include "IndexedList.hpp"
+#include "../Singly Linked List/Templated List using 2 Classes (Basic Functions) + Nested Iterator Class/Singly_List.hpp"
+#include <chrono>
+#include <cstdint>
+
+// Benchmarks for IndexedList.hpp
+// Compile with optimizations on , otherwise the numbers mean nothing :
+// g++ -std=c++17 -O2 -pthread benchmark.cpp -o benchmark
+
+using Clock = std::chrono::steady_clock;
+
+double ms_since(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// Defeats the optimizer so the lists are really walked
+volatile long long sink = 0;
+
+// Same random numbers for every list
+uint32_t next_random(uint32_t &state)
+{
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+// --- 1. for (i) sum += l[i] ---
+template <typename L>
+void indexed_loop(const char *name, int n)
+{
+    L l;
+    for (int i = 0; i < n; i++)
+        l.push_back_list(i);
+    auto start = Clock::now();
+    long long sum = 0;
+    for (int i = 0; i < l.size; i++)
+        sum += l[i];
+    sink = sink + sum;
+    double ms = ms_since(start);
+    std::cout << "  " << name << " n = " << n << " : " << ms << " ms (" << ms * 1e6 / n << " ns per l[i])" << std::endl;
+}
+
+// --- 2. Random positional inserts then removes ---
+template <typename L>
+void positional(const char *name, int n)
+{
+    L l;
+    uint32_t state = 12345;
+    auto start = Clock::now();
+    for (int i = 0; i < n; i++)
+        l.insert_node(i, (int)(next_random(state) % (uint32_t)(l.size + 1)));
+    double insert_ms = ms_since(start);
+    start = Clock::now();
+    while (l.size > 0)
+        l.remove_node((int)(next_random(state) % (uint32_t)l.size));
+    double remove_ms = ms_since(start);
+    std::cout << "  " << name << " n = " << n << " : insert_node " << insert_ms << " ms , remove_node " << remove_ms << " ms" << std::endl;
+}
+
+int main()
+{
+    std::cout << "--- 1. Index loop : for (i) sum += l[i] ---" << std::endl;
+    // List<T> is O(n^2) here : 1M would take minutes , so it runs on smaller sizes
+    indexed_loop<List<int>>("List        ", 10000);
+    indexed_loop<List<int>>("List        ", 50000);
+    indexed_loop<IndexedList<int>>("IndexedList ", 50000);
+    indexed_loop<IndexedList<int>>("IndexedList ", 1000000);
+    std::cout << std::endl;
+
+    std::cout << "--- 2. insert_node / remove_node at random positions ---" << std::endl;
+    positional<List<int>>("List        ", 50000);
+    positional<IndexedList<int>>("IndexedList ", 50000);
+    positional<IndexedList<int>>("IndexedList ", 1000000);
+    return 0;
+}
@@ -0,0 +1,46 @@
+#include <iostream>
+#include <string>
+#include "IndexedList.hpp"
+
+using namespace std;
+
+int main()
+{
+    IndexedList<int> l1;
+    for (int i = 1; i <= 10; i++)
+    {
+        l1.push_back_list(i * 10);
+    }
+    l1.push_front_list(5);
+    l1.insert_node(55, 6);
+    cout << l1;                                   // 5 10 20 30 40 50 55 60 70 80 90 100
+
+    l1.remove_node(0);
+    l1.remove_node_val(55);
+    l1.pop_back_list();
+    cout << l1;                                   // 10 20 30 40 50 60 70 80 90
+
+    //Index loops are fine here : every l1[i] is O(log n)
+    for (int i = 0; i < l1.size; i++)
+    {
+        l1[i] += i;
+    }
+    cout << l1;                                   // 10 21 32 43 54 65 76 87 98
+    cout << "Index of 76 : " << l1.linear_search(76) << " , at_list(2) = " << l1.at_list(2) << endl;
+
+    //Same Iterator use as List<T>
+    for (int x : l1)
+    {
+        cout << x << " ";
+    }
+    cout << endl;
+
+    IndexedList<string> l2;
+    l2.push_back_list("banana");
+    l2.push_back_list("cherry");
+    l2.insert_node("apple", 0);
+    IndexedList<string> l3(l2);
+    l2.join(l3);                                  // l3 is now empty
+    cout << l2 << l2.size << " " << l3.size << endl;  // apple banana cherry apple banana cherry , 6 0
+    return 0;
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include <atomic>
+#include <memory>
+#include <utility>
+#include "../../Allocator/NodePool.hpp"
+
+// The Node<T> of List<T> , with an atomic next so several threads can link and unlink it at once.
+// Nodes come from the shared node pool (PoolAllocator's default) , which is safe to use from any thread.
+template <typename T>
+class AtomicNode
+{
+public:
+    T val;
+    std::atomic<AtomicNode<T>*> next;
+    AtomicNode(const T& v = T(), AtomicNode<T>* n = nullptr) : val(v), next(n) {}
+    AtomicNode(T&& v, AtomicNode<T>* n = nullptr) : val(std::move(v)), next(n) {}
+
+    template <typename V>
+    static AtomicNode<T>* make(V&& v)
+    {
+        using traits = std::allocator_traits<PoolAllocator<AtomicNode<T>>>;
+        PoolAllocator<AtomicNode<T>> alloc;
+        AtomicNode<T>* p = traits::allocate(alloc, 1);
+        try
+        {
+            traits::construct(alloc, p, std::forward<V>(v));
+        }
+        catch (...)
+        {
+            traits::deallocate(alloc, p, 1);   //T's copy threw , give the memory back
+            throw;
+        }
+        return p;
+    }
+
+    // Also the deleter handed to HazardPointers::retire
+    static void destroy(void* p)
+    {
+        using traits = std::allocator_traits<PoolAllocator<AtomicNode<T>>>;
+        PoolAllocator<AtomicNode<T>> alloc;
+        traits::destroy(alloc, static_cast<AtomicNode<T>*>(p));
+        traits::deallocate(alloc, static_cast<AtomicNode<T>*>(p), 1);
+    }
+};
@@ -0,0 +1,191 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+// Hazard Pointers : when is it safe to free a node that other threads may still be reading?
+// In a lock-free list a thread can load a node pointer , get paused , and by the time it reads node->next
+// another thread has already popped that node. If it was deleted (or handed out again by the node pool)
+// the first thread reads garbage , or its compare_exchange succeeds on a recycled address (the ABA problem).
+// The fix :
+// - Before a thread touches a node it PUBLISHES the pointer in one of its hazard slots , then checks the
+//   node is still reachable (if not , it retries). From then on nobody frees that node.
+// - A thread that unlinks a node does not free it , it RETIRES it : the node goes on the thread's own list.
+// - Once that list has RETIRE_SCAN nodes , the thread reads every published hazard pointer and frees
+//   the retired nodes nobody has published. The rest wait for the next scan.
+// So a node is freed only after no thread can still be looking at it , and memory stays bounded.
+// Usage (slot 0 of the calling thread) :
+// Node* p = HazardPointers::protect(0, top);   // top is a std::atomic<Node*>
+// ... read p->next ...
+// HazardPointers::clear(0);
+// HazardPointers::retire(p, &delete_node);     // after unlinking p
+class HazardPointers
+{
+public:
+    static const int MAX_THREADS = 128;   // Threads using hazard pointers at the same time
+    static const int SLOTS = 2;           // Hazard pointers per thread (the queue needs 2)
+
+private:
+    struct Record
+    {
+        std::atomic<bool> taken{false};
+        std::atomic<void*> hazard[SLOTS] = {};
+    };
+
+    struct Retired
+    {
+        void* ptr;
+        void (*deleter)(void*);
+    };
+
+    static const size_t RETIRE_SCAN = 2 * MAX_THREADS * SLOTS;
+
+    // Shared by all threads. Never destroyed on purpose (like SharedNodePool) : a thread may still retire nodes
+    // after the static objects are gone.
+    struct Domain
+    {
+        Record records[MAX_THREADS];
+        std::atomic<int> used{0};   // Records ever taken , scans only look at records[0 .. used)
+
+        // Nodes retired by threads that have ended while someone still protected them
+        std::mutex orphans_lock;
+        std::vector<Retired> orphans;
+    };
+
+    static Domain& domain()
+    {
+        static Domain* d = new Domain;
+        return *d;
+    }
+
+    // The calling thread's record and retired list , given back when the thread ends
+    struct Owner
+    {
+        Record* rec = nullptr;
+        std::vector<Retired> retired;
+
+        Owner()
+        {
+            Domain& d = domain();
+            for (int i = 0; i < MAX_THREADS; i++)
+            {
+                bool expected = false;
+                if (!d.records[i].taken.load(std::memory_order_relaxed) && d.records[i].taken.compare_exchange_strong(expected, true))
+                {
+                    rec = &d.records[i];
+                    int seen = d.used.load();
+                    while (seen < i + 1 && !d.used.compare_exchange_weak(seen, i + 1))
+                    {
+                    }
+                    return;
+                }
+            }
+            throw std::runtime_error("HazardPointers: Too many threads.");
+        }
+
+        ~Owner()
+        {
+            Domain& d = domain();
+            for (int s = 0; s < SLOTS; s++)
+                rec->hazard[s].store(nullptr);
+            {
+                std::lock_guard<std::mutex> guard(d.orphans_lock);
+                retired.insert(retired.end(), d.orphans.begin(), d.orphans.end());
+                d.orphans.clear();
+            }
+            scan(retired);
+            if (!retired.empty())   // Still protected by a running thread : the next thread that scans frees them
+            {
+                std::lock_guard<std::mutex> guard(d.orphans_lock);
+                d.orphans.insert(d.orphans.end(), retired.begin(), retired.end());
+            }
+            rec->taken.store(false);
+        }
+    };
+
+    static Owner& owner()
+    {
+        thread_local Owner o;
+        return o;
+    }
+
+    // Frees every node of list that no thread has published , keeps the others
+    static void scan(std::vector<Retired>& list)
+    {
+        Domain& d = domain();
+        std::vector<void*> hazards;
+        int n = d.used.load();
+        for (int i = 0; i < n; i++)
+        {
+            for (int s = 0; s < SLOTS; s++)
+            {
+                void* p = d.records[i].hazard[s].load();
+                if (p != nullptr)
+                    hazards.push_back(p);
+            }
+        }
+        std::sort(hazards.begin(), hazards.end());
+
+        size_t kept = 0;
+        for (size_t i = 0; i < list.size(); i++)
+        {
+            if (std::binary_search(hazards.begin(), hazards.end(), list[i].ptr))
+                list[kept++] = list[i];
+            else
+                list[i].deleter(list[i].ptr);
+        }
+        list.resize(kept);
+    }
+
+public:
+    // Loads src into hazard slot of the calling thread , and returns it once it is known to still be in src
+    template <typename P>
+    static P* protect(int slot, const std::atomic<P*>& src)
+    {
+        std::atomic<void*>& hp = owner().rec->hazard[slot];
+        P* p = src.load();
+        while (true)
+        {
+            hp.store(p);
+            P* again = src.load();   // Still there after publishing : nobody can have freed it since
+            if (again == p)
+                return p;
+            p = again;
+        }
+    }
+
+    // Publishes p without checking (the caller re-checks that p is still reachable)
+    static void set(int slot, void* p)
+    {
+        owner().rec->hazard[slot].store(p);
+    }
+
+    static void clear(int slot)
+    {
+        owner().rec->hazard[slot].store(nullptr, std::memory_order_release);
+    }
+
+    // p is unlinked : deleter(p) runs once no thread has it published
+    static void retire(void* p, void (*deleter)(void*))
+    {
+        Owner& o = owner();
+        o.retired.push_back({p, deleter});
+        if (o.retired.size() >= RETIRE_SCAN)
+        {
+            Domain& d = domain();
+            {
+                std::unique_lock<std::mutex> guard(d.orphans_lock, std::try_to_lock);
+                if (guard.owns_lock() && !d.orphans.empty())
+                {
+                    o.retired.insert(o.retired.end(), d.orphans.begin(), d.orphans.end());
+                    d.orphans.clear();
+                }
+            }
+            scan(o.retired);
+        }
+    }
+};
+
@@ -0,0 +1,132 @@
+#pragma once
+#include <atomic>
+#include <utility>
+#include "AtomicNode.hpp"
+#include "HazardPointers.hpp"
+
+// Michael-Scott Queue : a lock-free FIFO queue , i.e a singly linked list with head and tail pointers
+// that any number of threads push to (at tail) and pop from (at head) at the same time.
+// - head always points to a DUMMY node , the first real element is head->next. So head and tail are never
+//   nullptr , and an empty queue is head == tail with head->next == nullptr.
+// - push : compare_exchange the last node's next from nullptr to the new node , then swing tail to it.
+//   Those are two steps , so tail can lag one node behind. Any thread that sees tail->next != nullptr
+//   swings tail forward itself ("helping") instead of waiting for the pushing thread.
+// - pop  : read head->next's value , then compare_exchange head from the dummy to head->next ,
+//   which becomes the new dummy. The old dummy is retired.
+// Nodes are read through hazard pointers (slot 0 : head / tail , slot 1 : head->next) so none is freed
+// or reused while another thread still reads it (HazardPointers.hpp).
+// Usage :
+// LockFreeQueue<int> q;   // Shared by any number of producers and consumers
+// q.push(5);
+// int x;
+// if (q.try_pop(x)) ...
+template <typename T>
+class LockFreeQueue
+{
+    using Node = AtomicNode<T>;
+
+    std::atomic<Node*> head;
+    std::atomic<Node*> tail;
+
+    void link(Node* n)
+    {
+        while (true)
+        {
+            Node* last = HazardPointers::protect(0, tail);
+            Node* after = last->next.load();
+            if (last != tail.load())
+                continue;
+            if (after != nullptr)   // tail is lagging : help move it , then retry
+            {
+                tail.compare_exchange_strong(last, after);
+                continue;
+            }
+            Node* expected = nullptr;
+            if (last->next.compare_exchange_strong(expected, n))
+            {
+                tail.compare_exchange_strong(last, n);   // If this fails another thread already helped
+                HazardPointers::clear(0);
+                return;
+            }
+        }
+    }
+
+public:
+    // T must be default constructible (for the dummy node) and copyable (see try_pop)
+    LockFreeQueue()
+    {
+        Node* dummy = Node::make(T());
+        head.store(dummy);
+        tail.store(dummy);
+    }
+
+    // Shared between threads by reference , never copied
+    LockFreeQueue(const LockFreeQueue&) = delete;
+    LockFreeQueue& operator=(const LockFreeQueue&) = delete;
+
+    // Only when no other thread uses the queue any more
+    ~LockFreeQueue()
+    {
+        Node* n = head.load();
+        while (n != nullptr)
+        {
+            Node* after = n->next.load(std::memory_order_relaxed);
+            Node::destroy(n);
+            n = after;
+        }
+    }
+
+    void push(const T& val)
+    {
+        link(Node::make(val));
+    }
+
+    void push(T&& val)
+    {
+        link(Node::make(std::move(val)));
+    }
+
+    // false when the queue is empty
+    bool try_pop(T& out)
+    {
+        while (true)
+        {
+            Node* first = HazardPointers::protect(0, head);
+            Node* last = tail.load();
+            Node* after = first->next.load();
+            HazardPointers::set(1, after);
+            if (first != head.load())   // Re-check after publishing after : first->next can't have changed
+                continue;
+            if (after == nullptr)
+            {
+                HazardPointers::clear(0);
+                HazardPointers::clear(1);
+                return false;
+            }
+            if (first == last)   // tail is lagging behind a node that is already linked : help
+            {
+                tail.compare_exchange_strong(last, after);
+                continue;
+            }
+            // Copy , not move : until our exchange wins , other threads may be copying the same value
+            T val = after->val;
+            if (head.compare_exchange_strong(first, after))
+            {
+                out = std::move(val);
+                HazardPointers::clear(0);
+                HazardPointers::clear(1);
+                HazardPointers::retire(first, &Node::destroy);
+                return true;
+            }
+        }
+    }
+
+    // A snapshot : other threads may push or pop right after
+    bool empty()
+    {
+        Node* first = HazardPointers::protect(0, head);
+        bool none = first->next.load() == nullptr;
+        HazardPointers::clear(0);
+        return none;
+    }
+};
@@ -0,0 +1,92 @@
+#pragma once
+#include <atomic>
+#include <utility>
+#include "AtomicNode.hpp"
+#include "HazardPointers.hpp"
+
+// Treiber Stack : a lock-free stack , i.e a singly linked list where only the head (top) changes.
+// push : new node -> next = top , then compare_exchange top from (what we read) to (new node).
+//        If another thread changed top in between the exchange fails , we re-read and try again.
+// pop  : read top , read top->next , compare_exchange top from (top) to (top->next).
+// No thread ever waits for another : a failed exchange means some other thread's push / pop succeeded.
+// The danger is in pop : between reading top and reading top->next , another thread may pop and free that
+// node (or pop it , free it and push a NEW node at the same address , so our exchange wrongly succeeds : ABA).
+// So pop publishes top in a hazard pointer first , and popped nodes are retired , not deleted (HazardPointers.hpp).
+// Usage :
+// LockFreeStack<int> s;   // Shared by any number of threads
+// s.push(5);
+// int x;
+// if (s.try_pop(x)) ...
+template <typename T>
+class LockFreeStack
+{
+    using Node = AtomicNode<T>;
+
+    std::atomic<Node*> top;
+
+    void link(Node* n)
+    {
+        Node* old = top.load(std::memory_order_relaxed);
+        do
+        {
+            n->next.store(old, std::memory_order_relaxed);
+        } while (!top.compare_exchange_weak(old, n, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+public:
+    LockFreeStack() : top(nullptr) {}
+
+    // Shared between threads by reference , never copied
+    LockFreeStack(const LockFreeStack&) = delete;
+    LockFreeStack& operator=(const LockFreeStack&) = delete;
+
+    // Only when no other thread uses the stack any more
+    ~LockFreeStack()
+    {
+        Node* n = top.load();
+        while (n != nullptr)
+        {
+            Node* after = n->next.load(std::memory_order_relaxed);
+            Node::destroy(n);
+            n = after;
+        }
+    }
+
+    void push(const T& val)
+    {
+        link(Node::make(val));
+    }
+
+    void push(T&& val)
+    {
+        link(Node::make(std::move(val)));
+    }
+
+    // false when the stack is empty
+    bool try_pop(T& out)
+    {
+        while (true)
+        {
+            Node* t = HazardPointers::protect(0, top);
+            if (t == nullptr)
+            {
+                HazardPointers::clear(0);
+                return false;
+            }
+            Node* after = t->next.load();   // Safe : t can't be freed while it is published
+            if (top.compare_exchange_strong(t, after))
+            {
+                HazardPointers::clear(0);
+                out = std::move(t->val);   // t is ours now , other threads only ever read its next
+                HazardPointers::retire(t, &Node::destroy);
+                return true;
+            }
+        }
+    }
+
+    // A snapshot : other threads may push or pop right after
+    bool empty() const
+    {
+        return top.load() == nullptr;
+    }
+};
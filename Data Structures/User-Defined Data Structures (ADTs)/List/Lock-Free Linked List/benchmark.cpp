@@ -0,0 +1,121 @@
+#include "LockFreeQueue.hpp"
+#include "LockFreeStack.hpp"
+#include "../Singly Linked List/Templated List using 2 Classes (Basic Functions) + Nested Iterator Class/Singly_List.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Benchmarks for LockFreeQueue.hpp / LockFreeStack.hpp
+// Compile with optimizations on , otherwise the numbers mean nothing :
+// g++ -std=c++17 -O2 -pthread benchmark.cpp -o benchmark
+// ./benchmark        -> 1 to 8 threads
+// ./benchmark 16     -> 1 to 16 threads
+// On a single core machine the threads only take turns , so expect flat (or falling) numbers there.
+
+using Clock = std::chrono::steady_clock;
+
+double ms_since(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// Defeats the optimizer
+std::atomic<long long> sink{0};
+
+// What programs share today : a List behind one mutex
+class LockedList
+{
+    std::mutex lock;
+    List<long long> l;
+
+public:
+    void push(long long val)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        l.push_back_list(val);
+    }
+
+    bool try_pop(long long &out)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        if (l.size == 0)
+            return false;
+        out = l[0];
+        l.pop_front_list();
+        return true;
+    }
+};
+
+// --- MPMC : threads / 2 producers push , the other half pop until everything pushed has been popped ---
+// (1 thread : pushes everything , then pops everything)
+template <typename Q>
+double mpmc(int threads, int total)
+{
+    Q q;
+    int producers = threads > 1 ? threads / 2 : 1;
+    int consumers = threads > 1 ? threads - producers : 1;
+    int per_producer = total / producers;
+    int expected = per_producer * producers;
+    std::atomic<int> popped{0};
+
+    auto produce = [&](int id) {
+        for (int i = 0; i < per_producer; i++)
+            q.push((long long)id * per_producer + i);
+    };
+    auto consume = [&]() {
+        long long x, sum = 0;
+        while (popped.load(std::memory_order_relaxed) < expected)
+        {
+            if (q.try_pop(x))
+            {
+                sum += x;
+                popped.fetch_add(1, std::memory_order_relaxed);
+            }
+            else
+            {
+                std::this_thread::yield();   // Empty for now , let a producer run
+            }
+        }
+        sink += sum;
+    };
+
+    auto start = Clock::now();
+    if (threads == 1)
+    {
+        produce(0);
+        consume();
+    }
+    else
+    {
+        std::vector<std::thread> pool;
+        for (int p = 0; p < producers; p++)
+            pool.emplace_back(produce, p);
+        for (int c = 0; c < consumers; c++)
+            pool.emplace_back(consume);
+        for (std::thread &t : pool)
+            t.join();
+    }
+    return ms_since(start);
+}
+
+int main(int argc, char **argv)
+{
+    int max_threads = argc > 1 ? atoi(argv[1]) : 8;
+    const int total = 2000000;
+    std::cout << "MPMC , " << total / 1000000 << "M pushes + pops , Mops/s (higher is better) , "
+              << std::thread::hardware_concurrency() << " hardware threads" << std::endl;
+    std::cout << "threads | mutex + List | LockFreeQueue | LockFreeStack" << std::endl;
+    std::cout << std::fixed << std::setprecision(1);
+    for (int t = 1; t <= max_threads; t *= 2)
+    {
+        double locked = mpmc<LockedList>(t, total);
+        double queue = mpmc<LockFreeQueue<long long>>(t, total);
+        double stack = mpmc<LockFreeStack<long long>>(t, total);
+        std::cout << std::setw(7) << t << " | " << std::setw(12) << 2.0 * total / locked / 1000 << " | " << std::setw(13)
+                  << 2.0 * total / queue / 1000 << " | " << std::setw(13) << 2.0 * total / stack / 1000 << std::endl;
+    }
+    return 0;
+}
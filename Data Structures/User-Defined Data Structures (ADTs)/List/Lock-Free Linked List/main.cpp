@@ -0,0 +1,58 @@
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "LockFreeQueue.hpp"
+#include "LockFreeStack.hpp"
+
+using namespace std;
+
+int main()
+{
+    //4 producers push 1000 numbers each , 4 consumers pop them : no mutex anywhere
+    LockFreeQueue<int> q;
+    atomic<long long> sum{0};
+    atomic<int> popped{0};
+    vector<thread> threads;
+    for (int p = 0; p < 4; p++)
+    {
+        threads.emplace_back([&q]() {
+            for (int i = 1; i <= 1000; i++)
+            {
+                q.push(i);
+            }
+        });
+    }
+    for (int c = 0; c < 4; c++)
+    {
+        threads.emplace_back([&]() {
+            int x;
+            while (popped.load() < 4000)
+            {
+                if (q.try_pop(x))
+                {
+                    sum += x;
+                    popped++;
+                }
+            }
+        });
+    }
+    for (thread& t : threads)
+    {
+        t.join();
+    }
+    cout << "Popped " << popped << " numbers , sum = " << sum << endl;   // 4000 , 4 * 500500 = 2002000
+
+    //Single thread use is the same as any queue / stack
+    LockFreeStack<string> s;
+    s.push("first");
+    s.push("second");
+    string top;
+    while (s.try_pop(top))
+    {
+        cout << top << " ";                       // second first
+    }
+    cout << endl;
+    cout << boolalpha << q.empty() << " " << s.empty() << endl;   // true true
+    return 0;
+}
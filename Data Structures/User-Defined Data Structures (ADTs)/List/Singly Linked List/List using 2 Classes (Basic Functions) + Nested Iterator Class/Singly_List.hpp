@@ -1,5 +1,6 @@
 #pragma once
 #include <iostream>
+#include <functional>
 
 using namespace std;
 //You can also use this Node class Nested inside List
@@ -13,6 +14,31 @@ public:
 class List
 {
     Node *head, *tail;
+
+    //Merges two sorted chains into one and returns its first node.
+    //On ties a wins , so a must hold the elements that came first (that's what keeps the sort stable).
+    template <typename Compare>
+    static Node* merge_runs(Node* a, Node* b, Compare& less)
+    {
+        Node* first = nullptr;
+        Node** link = &first;   //The next field to fill
+        while (a != nullptr && b != nullptr)
+        {
+            if (less(b->val, a->val))
+            {
+                *link = b;
+                b = b->next;
+            }
+            else
+            {
+                *link = a;
+                a = a->next;
+            }
+            link = &(*link)->next;
+        }
+        *link = (a != nullptr) ? a : b;
+        return first;
+    }
 public:
     int size = 0;
     //You can also keep the count of size if you want
@@ -322,6 +348,79 @@ public:
         }
     }
 
+    //Using Merge Sort on List : O(n log n) , and no value is ever copied or swapped (only next pointers change)
+    //Bottom-up , like counting in binary : bin[i] holds a sorted run of 2^i nodes. Each node taken from the list is
+    //a run of 1 that gets merged with bin[0] , the result with bin[1] ... until it finds an empty bin.
+    //64 bins are enough for any list , so the extra memory is O(1) , and there is no recursion.
+    //Merging mostly recently touched nodes is also much kinder to the cache than passes over the whole list.
+    //Stable : equal values keep their order (selectionSort doesn't promise that).
+    void sort()
+    {
+        sort(std::less<int>());
+    }
+
+    //less(a , b) must return true when a has to come before b , e.g sort([](const int& a, const int& b) { return a > b; })
+    template <typename Compare>
+    void sort(Compare less)
+    {
+        if (head == nullptr || head->next == nullptr)
+        {
+            return;  // Empty list or single node already sorted
+        }
+        Node* bin[64] = {};
+        while (head != nullptr)
+        {
+            Node* carry = head;
+            head = head->next;
+            carry->next = nullptr;
+            int i = 0;
+            for (; bin[i] != nullptr; i++)
+            {
+                carry = merge_runs(bin[i], carry, less);   //bin[i] holds older elements , it goes first
+                bin[i] = nullptr;
+            }
+            bin[i] = carry;
+        }
+        for (int i = 0; i < 64; i++)
+        {
+            if (bin[i] != nullptr)
+            {
+                head = merge_runs(bin[i], head, less);   //Higher bins are older
+            }
+        }
+        tail = head;
+        while (tail->next != nullptr)
+        {
+            tail = tail->next;
+        }
+    }
+
+    //Merges the sorted list other into this sorted list by relinking , other becomes empty (like std::list::merge)
+    void merge(List& other)
+    {
+        merge(other, std::less<int>());
+    }
+
+    template <typename Compare>
+    void merge(List& other, Compare less)
+    {
+        if (&other == this || other.head == nullptr)
+        {
+            return;
+        }
+        if (head == nullptr)
+        {
+            join(other);
+            return;
+        }
+        Node* last = less(other.tail->val, tail->val) ? tail : other.tail;   //Ties : other's element goes after ours
+        head = merge_runs(head, other.head, less);
+        tail = last;
+        size += other.size;
+        other.head = other.tail = nullptr;
+        other.size = 0;
+    }
+
     void append_shared(List& other)    //std::list::merge but without sorting
     {
         if (other.head == nullptr)
@@ -0,0 +1,56 @@
+#include "Singly_List.hpp"
+#include <chrono>
+#include <functional>
+
+// Sorting benchmark for the int Singly_List.hpp : selectionSort vs merge sort (sort())
+// g++ -std=c++17 -O2 benchmark.cpp -o benchmark
+
+using Clock = std::chrono::steady_clock;
+
+double ms_since(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+int main()
+{
+    unsigned x = 1;
+    for (int n : {1000, 10000, 20000, 100000, 1000000, 10000000})
+    {
+        List a, b;
+        for (int i = 0; i < n; i++)
+        {
+            x = x * 1103515245 + 12345;
+            a.push_back_list((int)(x >> 8));
+            b.push_back_list((int)(x >> 8));
+        }
+        std::cout << n << " ints : ";
+        if (n <= 20000) // Beyond this selectionSort takes minutes
+        {
+            auto start = Clock::now();
+            a.selectionSort();
+            std::cout << "selectionSort " << ms_since(start) << " ms | ";
+        }
+        auto start = Clock::now();
+        b.sort();
+        std::cout << "sort " << ms_since(start) << " ms";
+        if (n <= 20000)
+            std::cout << " , same result : " << (a == b ? "yes" : "NO");
+        std::cout << std::endl;
+    }
+
+    // Descending with a comparator , then merging two sorted lists
+    List c, d;
+    for (int i = 0; i < 1000000; i++)
+    {
+        c.push_back_list(2 * i);
+        d.push_back_list(2 * i + 1);
+    }
+    auto start = Clock::now();
+    c.merge(d);
+    std::cout << "merge of two sorted 1M lists : " << ms_since(start) << " ms" << std::endl;
+    start = Clock::now();
+    c.sort(std::greater<int>());
+    std::cout << "sort(greater) of 2M : " << ms_since(start) << " ms" << std::endl;
+    return 0;
+}
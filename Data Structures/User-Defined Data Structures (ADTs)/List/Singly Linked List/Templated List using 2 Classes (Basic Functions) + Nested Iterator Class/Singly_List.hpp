@@ -1,5 +1,9 @@
 #pragma once
 #include <iostream>
+#include <functional>
+#include <memory>
+#include <utility>
+#include "../../../Allocator/NodePool.hpp"
 
 using namespace std;
 
@@ -9,55 +13,218 @@ class Node
 public:
     T val;
     Node<T>* next;
-    Node(T v = 0, Node<T>* n = nullptr) : val(v), next(n) {}
+    // val is copied (or moved) once , straight from the argument
+    Node(const T& v = T(), Node<T>* n = nullptr) : val(v), next(n) {}
+    Node(T&& v, Node<T>* n = nullptr) : val(std::move(v)), next(n) {}
+
+    // Builds val from any constructor arguments of T , no temporary T at all (used by emplace)
+    template <typename... Args>
+    Node(std::in_place_t, Args&&... args) : val(std::forward<Args>(args)...), next(nullptr) {}
 };
-template <typename T>
+// Node Memory :
+// Every Node comes from Alloc (rebound to Node<T>) instead of plain new / delete.
+// By default that is PoolAllocator (../../../Allocator/NodePool.hpp) : a slab allocator where taking a node
+// is a pointer bump or a free list pop , and nodes made one after another sit next to each other in memory.
+// Any std::allocator compatible type works , e.g List<int, std::allocator<int>> is the old new / delete behaviour.
+template <typename T, typename Alloc = PoolAllocator<T>>
 class List
 {
+    using NodeAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Node<T>>;
+    using traits = std::allocator_traits<NodeAlloc>;
+
     Node<T>* head;
     Node <T>* tail;
-public:
-    int size = 0;
-    //You can also keep the count of size if you want
-    List()
+    [[no_unique_address]] NodeAlloc alloc;
+
+    // Raw memory from the allocator , then the Node is constructed in it (args go to one of Node's constructors)
+    template <typename... Args>
+    Node<T>* new_node(Args&&... args)
     {
-        head = nullptr;
-        tail = nullptr;
-        size = 0;
+        Node<T>* p = traits::allocate(alloc, 1);
+        try
+        {
+            traits::construct(alloc, p, std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            traits::deallocate(alloc, p, 1);   //T's copy threw , give the memory back
+            throw;
+        }
+        return p;
     }
-    void push_front_list(T val)
+
+    void free_node(Node<T>* p)
     {
-        Node<T>* newNode = new Node<T>(val);
-        if(head == nullptr)
+        traits::destroy(alloc, p);
+        traits::deallocate(alloc, p, 1);
+    }
+
+    //Merges two sorted chains into one and returns its first node.
+    //On ties a wins , so a must hold the elements that came first (that's what keeps the sort stable).
+    template <typename Compare>
+    static Node<T>* merge_runs(Node<T>* a, Node<T>* b, Compare& less)
+    {
+        Node<T>* first = nullptr;
+        Node<T>** link = &first;   //The next field to fill
+        while (a != nullptr && b != nullptr)
         {
-            head = newNode;
-            tail = newNode;
+            if (less(b->val, a->val))
+            {
+                *link = b;
+                b = b->next;
+            }
+            else
+            {
+                *link = a;
+                a = a->next;
+            }
+            link = &(*link)->next;
         }
-        else
+        *link = (a != nullptr) ? a : b;
+        return first;
+    }
+
+    //merge for lists on different pools : one pass over both lists , a copy of each of other's values is linked
+    //in right where it belongs. O(n + m) , other is left as it was.
+    template <typename Compare>
+    void merge_copy(const List& other, Compare& less)
+    {
+        Node<T>** link = &head;   //The next field that may get a new node
+        for (Node<T>* b = other.head; b != nullptr; b = b->next)
         {
-            newNode->next = head;
-            head = newNode;
+            while (*link != nullptr && !less(b->val, (*link)->val))   //Ties : ours stay first
+            {
+                link = &(*link)->next;
+            }
+            Node<T>* newNode = new_node(b->val);
+            newNode->next = *link;
+            *link = newNode;
+            if (newNode->next == nullptr)
+            {
+                tail = newNode;
+            }
+            size++;
+            link = &newNode->next;
         }
+    }
+
+    void link_front(Node<T>* newNode)
+    {
+        if (head == nullptr)
+        {
+            tail = newNode;
+        }
+        newNode->next = head;
+        head = newNode;
         size++;
-        return;
     }
-    //Can also use one line code : head = new Node(val , head) instead of all the code for push_front
 
-    void push_back_list(T val)
+    void link_back(Node<T>* newNode)
     {
-        Node<T>* newNode = new Node<T>(val);
-        if(head == nullptr)
+        if (head == nullptr)
         {
             head = newNode;
-            tail = newNode;
         }
         else
         {
-            tail->next= newNode;
-            tail = newNode;
+            tail->next = newNode;
         }
+        tail = newNode;
         size++;
-        return ;
+    }
+
+    // Takes over other's nodes , other is left empty
+    void steal(List& other) noexcept
+    {
+        head = other.head;
+        tail = other.tail;
+        size = other.size;
+        other.head = other.tail = nullptr;
+        other.size = 0;
+    }
+
+    // insert_node for any way of building the value (ind already checked)
+    template <typename... Args>
+    void emplace_at(int ind, Args&&... args)
+    {
+        if (ind == 0)
+        {
+            link_front(new_node(std::forward<Args>(args)...));
+            return;
+        }
+        if (ind == size)
+        {
+            link_back(new_node(std::forward<Args>(args)...));
+            return;
+        }
+        Node<T>* temp = head;
+        for (int i = 0; i < ind - 1; i++)
+        {
+            temp = temp->next;
+        }
+        Node<T>* newNode = new_node(std::forward<Args>(args)...);
+        newNode->next = temp->next;
+        temp->next = newNode;
+        size++;
+    }
+
+    // Deep copy of other's nodes (list must be empty)
+    void copy_nodes(const List& other)
+    {
+        for (Node<T>* otherCurrent = other.head; otherCurrent != nullptr; otherCurrent = otherCurrent->next)
+        {
+            push_back_list(otherCurrent->val);
+        }
+    }
+public:
+    int size = 0;
+    //You can also keep the count of size if you want
+    List()
+    {
+        head = nullptr;
+        tail = nullptr;
+        size = 0;
+    }
+    explicit List(const Alloc& a) : alloc(a)
+    {
+        head = nullptr;
+        tail = nullptr;
+        size = 0;
+    }
+    //lvalues are copied once , rvalues (temporaries or std::move) are only moved
+    void push_front_list(const T& val)
+    {
+        link_front(new_node(val));
+    }
+    void push_front_list(T&& val)
+    {
+        link_front(new_node(std::move(val)));
+    }
+    //Can also use one line code : head = new Node(val , head) instead of all the code for push_front
+
+    void push_back_list(const T& val)
+    {
+        link_back(new_node(val));
+    }
+    void push_back_list(T&& val)
+    {
+        link_back(new_node(std::move(val)));
+    }
+
+    // Construct the element inside its new Node from T's constructor arguments , no copy and no move.
+    // e.g : List<string> l; l.emplace_back(5, 'a'); builds "aaaaa" in place. Returns the new element.
+    template <typename... Args>
+    T& emplace_front(Args&&... args)
+    {
+        link_front(new_node(std::in_place, std::forward<Args>(args)...));
+        return head->val;
+    }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args)
+    {
+        link_back(new_node(std::in_place, std::forward<Args>(args)...));
+        return tail->val;
     }
     //If our Linked List class doesn't have a tail pointer then we need to iterate through the list for adding the new element at right side
 
@@ -71,9 +238,13 @@ public:
         {
             Node<T> *temp = head;
             head = head->next;
+            if (head == nullptr)    //Was the only node
+            {
+                tail = nullptr;
+            }
             temp->next = nullptr;   //Disconnect temp from the list (Optional here)
             size--;
-            delete temp;    //Now Deallocate the Node from the list
+            free_node(temp);    //Now Deallocate the Node from the list
         }
         return ;
     }
@@ -91,6 +262,12 @@ public:
         {
             cout<<"List is empty "<<endl;
         }
+        else if(head == tail)   //Only one node : there is no node before tail to stop at
+        {
+            free_node(head);
+            head = tail = nullptr;
+            size--;
+        }
         else
         {
             Node<T>* temp = head;
@@ -99,52 +276,31 @@ public:
                 temp = temp->next;
             }
             temp->next = nullptr;
-            delete tail;    //Delete the last node
+            free_node(tail);    //Delete the last node
             tail = temp;    //Update tail to previous node
             size--;
         }
         return ;
     }
-    void insert_node(T val, int ind)
+    void insert_node(const T& val, int ind)
     {
         if(ind<0 || ind>size)
         {
             cout<<"Invalid Index "<<endl;
             return;
         }
-        else if(ind == 0)   //Push_front() Case
-        {
-            push_front_list(val);
-            return ;
-        } //If you want then you can also write push_back case but its not needed here
-        else if(ind == size)
-        {
-            push_back_list(val);
-            return ;
-        }
-        else
+        emplace_at(ind, val);
+    }
+    void insert_node(T&& val, int ind)
+    {
+        if(ind<0 || ind>size)
         {
-            Node<T>* temp = head;
-            for(int i = 0 ; i<ind-1 && temp!= nullptr ; i++)
-            {
-                temp = temp->next;
-            }
-
-            // Check if we reached end of list prematurely
-            if (temp == nullptr)
-            {
-                push_back_list(val);
-                return;
-            }
-            //We could also use ind == size instead of temp==nullptr to check for the last position and do push back
-            Node<T>* newNode = new Node<T>(val);
-            newNode->next = temp->next;
-            temp->next = newNode;
-            size++;
-            return ;
+            cout<<"Invalid Index "<<endl;
+            return;
         }
+        emplace_at(ind, std::move(val));
     }
-    void remove_node_val(T val)
+    void remove_node_val(const T& val)
     {
         // Handle empty list
         if (head == nullptr)
@@ -173,7 +329,7 @@ public:
                     tail = temp;
                 }
 
-                delete newNode;
+                free_node(newNode);
                 size--;
             }
             else
@@ -211,11 +367,11 @@ public:
             temp->next = newNode->next;  // Bypass the node to delete (Changing the connection)
 
             newNode->next = nullptr;     // Optional: Disconnect before delete
-            delete newNode;              // Delete the node
+            free_node(newNode);          // Delete the node
             size--;
         }
     }
-    int linear_search(T target) //Returns Index
+    int linear_search(const T& target) //Returns Index
     {
         Node<T>* temp = head;
         int ind = 0;
@@ -284,6 +440,85 @@ public:
         }
     }
 
+    //Using Merge Sort on List : O(n log n) , and no value is ever copied or swapped (only next pointers change)
+    //Bottom-up , like counting in binary : bin[i] holds a sorted run of 2^i nodes. Each node taken from the list is
+    //a run of 1 that gets merged with bin[0] , the result with bin[1] ... until it finds an empty bin.
+    //64 bins are enough for any list , so the extra memory is O(1) , and there is no recursion.
+    //Merging mostly recently touched nodes is also much kinder to the cache than passes over the whole list.
+    //Stable : equal values keep their order (selectionSort doesn't promise that).
+    void sort()
+    {
+        sort(std::less<T>());
+    }
+
+    //less(a , b) must return true when a has to come before b , e.g sort([](const T& a, const T& b) { return a > b; })
+    template <typename Compare>
+    void sort(Compare less)
+    {
+        if (head == nullptr || head->next == nullptr)
+        {
+            return;  // Empty list or single node already sorted
+        }
+        Node<T>* bin[64] = {};
+        while (head != nullptr)
+        {
+            Node<T>* carry = head;
+            head = head->next;
+            carry->next = nullptr;
+            int i = 0;
+            for (; bin[i] != nullptr; i++)
+            {
+                carry = merge_runs(bin[i], carry, less);   //bin[i] holds older elements , it goes first
+                bin[i] = nullptr;
+            }
+            bin[i] = carry;
+        }
+        for (int i = 0; i < 64; i++)
+        {
+            if (bin[i] != nullptr)
+            {
+                head = merge_runs(bin[i], head, less);   //Higher bins are older
+            }
+        }
+        tail = head;
+        while (tail->next != nullptr)
+        {
+            tail = tail->next;
+        }
+    }
+
+    //Merges the sorted list other into this sorted list by relinking , other becomes empty (like std::list::merge)
+    void merge(List& other)
+    {
+        merge(other, std::less<T>());
+    }
+
+    template <typename Compare>
+    void merge(List& other, Compare less)
+    {
+        if (&other == this || other.head == nullptr)
+        {
+            return;
+        }
+        if (alloc != other.alloc)    // Different pools : other's nodes can't become ours , so copy them in order
+        {
+            merge_copy(other, less);
+            other.clear_list();
+            return;
+        }
+        if (head == nullptr)
+        {
+            join(other);
+            return;
+        }
+        Node<T>* last = less(other.tail->val, tail->val) ? tail : other.tail;   //Ties : other's element goes after ours
+        head = merge_runs(head, other.head, less);
+        tail = last;
+        size += other.size;
+        other.head = other.tail = nullptr;
+        other.size = 0;
+    }
+
     void print_list()
     {
         Node<T>* temp = head;
@@ -307,7 +542,7 @@ public:
         {
             Node<T>* nextNode = temp->next;  // Save next pointer first
             temp->next= nullptr;          // Optional (Remove the connection)
-            delete temp;                  // Delete current node
+            free_node(temp);              // Delete current node
             temp = nextNode;              // Move to next node
         }
         head = tail = nullptr;  //Optional (Already Dangling Pointers)
@@ -320,58 +555,65 @@ public:
     //Make your own copy constructor and assignment operator for deep copy
 
     // Copy Constructor :
-    List(const List<T>& other)
+    List(const List& other) : alloc(traits::select_on_container_copy_construction(other.alloc))
     {
-        head = nullptr;
-        if (other.head!= nullptr)
-        {
-            //Copy the Size Also :
-            size = other.size;
-            // Copy first node
-            head = new Node<T>(other.head->val);
-            Node<T>* current = head;
-            Node<T>* otherCurrent = other.head->next;
+        head = tail = nullptr;
+        size = 0;
+        // Copy every node in order (push_back_list keeps tail and size right)
+        copy_nodes(other);
+    }
 
-            // Copy remaining nodes
-            while (otherCurrent != nullptr)
-            {
-                current->next = new Node<T>(otherCurrent->val);
-                current = current->next;
-                otherCurrent = otherCurrent->next;
-            }
-        }
+    // Move Constructor : takes other's nodes , nothing is copied or allocated. other is left empty.
+    // noexcept , so Vector<List<T>> moves its lists when it grows instead of copying every node.
+    List(List&& other) noexcept : alloc(std::move(other.alloc))
+    {
+        steal(other);
     }
 
     // Copy Assignment Operator
-    List<T>& operator=(const List<T>& other)
+    List& operator=(const List& other)
     {
         if (this != &other)    // Protect against self-assignment
         {
             // Clear current list
             clear_list();
 
-            //Copy the Size Also :
-            size = other.size;
+            // Copy from other list (same logic as copy constructor) , our nodes still come from our own allocator
+            copy_nodes(other);
+        }
+        return *this;
+    }
 
-            // Copy from other list (same logic as copy constructor)
-            if (other.head!= nullptr)
+    // Move Assignment Operator
+    List& operator=(List&& other) noexcept(traits::propagate_on_container_move_assignment::value ||
+                                           traits::is_always_equal::value)
+    {
+        if (this != &other)
+        {
+            clear_list();
+            if constexpr (traits::propagate_on_container_move_assignment::value)
             {
-                head = new Node<T>(other.head->val);
-                Node<T>* current = head;
-                Node<T>* otherCurrent = other.head->next;
-
-                while (otherCurrent != nullptr)
+                alloc = std::move(other.alloc);
+                steal(other);
+            }
+            else if (alloc == other.alloc)
+            {
+                steal(other);
+            }
+            else
+            {
+                // Our allocator can't free other's nodes , so the values are moved one by one
+                for (Node<T>* temp = other.head; temp != nullptr; temp = temp->next)
                 {
-                    current->next = new Node<T>(otherCurrent->val);
-                    current = current->next;
-                    otherCurrent = otherCurrent->next;
+                    push_back_list(std::move(temp->val));
                 }
+                other.clear_list();
             }
         }
         return *this;
     }
 
-    friend ostream& operator << (ostream &out, const List<T>&list)
+    friend ostream& operator << (ostream &out, const List&list)
     {
         for (Node<T>*temp = list.head; temp != nullptr ; temp = temp -> next)
             out << temp -> val << ' ';
@@ -396,7 +638,7 @@ public:
 
     //Same Logic for all other relation operators != , < , > , <= , >=
     // This function can also be a friend of the List Class written outside
-    bool operator==(const List<T>& other)  //Won't work backwards if not a friend function (a==b) OK  But (b==a) Error if not friend
+    bool operator==(const List& other)  //Won't work backwards if not a friend function (a==b) OK  But (b==a) Error if not friend
     {
         if (size != other.size)
         {
@@ -420,7 +662,7 @@ public:
     }
 
 
-    void append_shared(List<T>& other)    //std::list::merge but without sorting
+    void append_shared(List& other)    //std::list::merge but without sorting
     {
         if (other.head == nullptr)
         {
@@ -440,7 +682,7 @@ public:
         size += other.size;
         //Here both lists share the other one list nodes so can be problematic if modify one other is modified as well
     }
-    void append(const List<T>& other)  //Copy the appending list
+    void append(const List& other)  //Copy the appending list
     {
         for (Node<T>* temp = other.head; temp!= nullptr; temp= temp->next)
         {
@@ -448,13 +690,22 @@ public:
         }
     }
 
-    void join(List<T>& other)  //Just like std::list::splice function that copies but then empties the other list
+    void join(List& other)  //Just like std::list::splice function that copies but then empties the other list
     {
         if (other.head == nullptr)
         {
             return;
         }
 
+        // Relinking is only allowed when our allocator can free other's nodes (same pool).
+        // Otherwise (two different NodePools) the values are copied and other is cleared , O(n) instead of O(1).
+        if (alloc != other.alloc)
+        {
+            append(other);
+            other.clear_list();
+            return;
+        }
+
         if (head == nullptr)
         {
             head = other.head;
@@ -476,6 +727,8 @@ public:
     class Iterator
     {
         Node<T>* ptr; //Points to current Node
+
+        friend class List;   //emplace_after needs the Node
     public:
         Iterator(Node<T>* p = nullptr) : ptr(p) {}
         T& operator*()
@@ -530,6 +783,27 @@ public:
         //return Iterator(tail->nullptr);
         return Iterator(nullptr);
     }
+
+    //Constructs a new element right after pos in O(1) (like std::forward_list::emplace_after) , returns an Iterator to it.
+    //pos must point to an element : there is nothing after end().
+    template <typename... Args>
+    Iterator emplace_after(Iterator pos, Args&&... args)
+    {
+        if (pos.ptr == nullptr)
+        {
+            cout<<"Invalid Position "<<endl;
+            return end();
+        }
+        Node<T>* newNode = new_node(std::in_place, std::forward<Args>(args)...);
+        newNode->next = pos.ptr->next;
+        pos.ptr->next = newNode;
+        if (pos.ptr == tail)
+        {
+            tail = newNode;
+        }
+        size++;
+        return Iterator(newNode);
+    }
 };
 
 
@@ -0,0 +1,254 @@
+#include "Singly_List.hpp"
+#include <chrono>
+#include <string>
+#include "../../../Vector/Vector.hpp"
+
+// Benchmarks for Singly_List.hpp
+// Compile with optimizations on , otherwise the numbers mean nothing :
+// g++ -std=c++17 -O2 -pthread benchmark.cpp -o benchmark
+
+using Clock = std::chrono::steady_clock;
+
+double ms_since(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// Defeats the optimizer so the lists are really built
+volatile long long sink = 0;
+
+// --- 1. Node allocation : new / delete vs NodePool ---
+// Queue churn : a list of window elements , every step pushes one at the back and pops one at the front
+template <typename L>
+double churn(L &l, int window, int steps)
+{
+    for (int i = 0; i < window; i++)
+        l.push_back_list(i);
+    auto start = Clock::now();
+    for (int i = 0; i < steps; i++)
+    {
+        l.push_back_list(i);
+        l.pop_front_list();
+    }
+    double ms = ms_since(start);
+    sink = sink + l.size;
+    l.clear_list();
+    return ms;
+}
+
+// Build a big list , walk it , free it
+template <typename L>
+double build_walk_clear(L &l, int n, int rounds)
+{
+    auto start = Clock::now();
+    for (int r = 0; r < rounds; r++)
+    {
+        for (int i = 0; i < n; i++)
+            l.push_back_list(i);
+        long long sum = 0;
+        for (int x : l)
+            sum += x;
+        sink = sink + sum;
+        l.clear_list();
+    }
+    return ms_since(start);
+}
+
+template <typename L>
+double churn_strings(L &l)
+{
+    for (int i = 0; i < 1000; i++)
+        l.push_back_list("short");
+    auto start = Clock::now();
+    for (int i = 0; i < 5000000; i++)
+    {
+        l.push_back_list("short");
+        l.pop_front_list();
+    }
+    double ms = ms_since(start);
+    l.clear_list();
+    return ms;
+}
+
+void bench_alloc()
+{
+    std::cout << "--- 1. Node allocation : new / delete vs NodePool ---" << std::endl;
+    const int STEPS = 20000000;
+    for (int window : {16, 100000})
+    {
+        List<int, std::allocator<int>> plain;
+        List<int> shared;
+        NodePool pool(sizeof(Node<int>), alignof(Node<int>));
+        List<int, PoolAllocator<int>> own{PoolAllocator<int>(pool)};
+        std::cout << "Churn , window " << window << " , " << STEPS << " push + pop : new/delete " << churn(plain, window, STEPS)
+                  << " ms | shared pool " << churn(shared, window, STEPS) << " ms | own pool " << churn(own, window, STEPS)
+                  << " ms" << std::endl;
+    }
+
+    const int N = 1000000, ROUNDS = 10;
+    List<int, std::allocator<int>> plain;
+    List<int> shared;
+    std::cout << "Build + walk + clear " << N << " x " << ROUNDS << " : new/delete " << build_walk_clear(plain, N, ROUNDS)
+              << " ms | shared pool " << build_walk_clear(shared, N, ROUNDS) << " ms" << std::endl;
+
+    List<std::string, std::allocator<std::string>> splain;
+    List<std::string> spool;
+    std::cout << "Churn List<string> , window 1000 : new/delete " << churn_strings(splain) << " ms | shared pool "
+              << churn_strings(spool) << " ms" << std::endl;
+    std::cout << std::endl;
+}
+
+// --- 2. Sorting : selectionSort (O(n^2) , swaps values) vs merge sort (O(n log n) , relinks nodes) ---
+template <typename L, typename F>
+double time_sort(L &l, F &&how)
+{
+    auto start = Clock::now();
+    how(l);
+    return ms_since(start);
+}
+
+void bench_sort()
+{
+    std::cout << "--- 2. Sorting : selectionSort vs sort() ---" << std::endl;
+    unsigned x = 1;
+    auto next = [&x]()
+    { x = x * 1103515245 + 12345; return (int)(x >> 8); };
+
+    for (int n : {1000, 10000, 20000, 100000, 1000000, 10000000})
+    {
+        List<int> a, b;
+        for (int i = 0; i < n; i++)
+        {
+            int v = next();
+            a.push_back_list(v);
+            b.push_back_list(v);
+        }
+        std::cout << n << " ints : ";
+        if (n <= 20000) // Beyond this selectionSort takes minutes
+            std::cout << "selectionSort " << time_sort(a, [](List<int> &l) { l.selectionSort(); }) << " ms | ";
+        std::cout << "sort " << time_sort(b, [](List<int> &l) { l.sort(); }) << " ms";
+        if (n <= 20000)
+            std::cout << " , same result : " << (a == b ? "yes" : "NO");
+        std::cout << std::endl;
+    }
+
+    // Strings : selectionSort copies three strings per swap , sort() copies none
+    for (int n : {10000, 500000})
+    {
+        List<std::string> a, b;
+        for (int i = 0; i < n; i++)
+        {
+            std::string v = "customer_record_" + std::to_string(next());
+            a.push_back_list(v);
+            b.push_back_list(v);
+        }
+        std::cout << n << " strings : ";
+        if (n <= 20000)
+            std::cout << "selectionSort " << time_sort(a, [](List<std::string> &l) { l.selectionSort(); }) << " ms | ";
+        std::cout << "sort " << time_sort(b, [](List<std::string> &l) { l.sort(); }) << " ms" << std::endl;
+    }
+    std::cout << std::endl;
+}
+
+// --- 3. Copies and moves : a type that counts them ---
+// Before move semantics and emplace , push_back_list(T val) and Node(T v) copied every value 3 times
+// (into the parameter , into Node's parameter , into val) , and a List returned by value or stored in a
+// Vector<List<T>> was deep copied node by node.
+struct Counted
+{
+    static long long copies, moves;
+    std::string text;
+
+    Counted(int n = 0, char c = 'x') : text(n, c) {}
+    Counted(const Counted &other) : text(other.text) { copies++; }
+    Counted(Counted &&other) noexcept : text(std::move(other.text)) { moves++; }
+    Counted &operator=(const Counted &other)
+    {
+        text = other.text;
+        copies++;
+        return *this;
+    }
+    Counted &operator=(Counted &&other) noexcept
+    {
+        text = std::move(other.text);
+        moves++;
+        return *this;
+    }
+    bool operator==(const Counted &other) const { return text == other.text; }
+    bool operator!=(const Counted &other) const { return text != other.text; }
+};
+long long Counted::copies = 0;
+long long Counted::moves = 0;
+
+template <typename F>
+void count_ops(const char *name, int n, F &&how)
+{
+    Counted::copies = Counted::moves = 0;
+    auto start = Clock::now();
+    how();
+    double ms = ms_since(start);
+    std::cout << "  " << name << " : " << ms << " ms , " << (double)Counted::copies / n << " copies + "
+              << (double)Counted::moves / n << " moves per element" << std::endl;
+}
+
+List<Counted> make_list(int n, bool which)
+{
+    List<Counted> a, b;
+    for (int i = 0; i < n; i++)
+        (which ? a : b).emplace_back(64, 'a');
+    return which ? std::move(a) : std::move(b); // Two candidates : no copy elision , so this is the move constructor
+}
+
+void bench_moves()
+{
+    std::cout << "--- 3. Copies and moves (64 char strings) ---" << std::endl;
+    const int N = 1000000;
+    Counted value(64, 'a');
+    count_ops("push_back_list(lvalue)     ", N, [&]() {
+        List<Counted> l;
+        for (int i = 0; i < N; i++)
+            l.push_back_list(value);
+    });
+    count_ops("push_back_list(Counted(..))", N, [&]() {
+        List<Counted> l;
+        for (int i = 0; i < N; i++)
+            l.push_back_list(Counted(64, 'a'));
+    });
+    count_ops("emplace_back(64 , 'a')     ", N, [&]() {
+        List<Counted> l;
+        for (int i = 0; i < N; i++)
+            l.emplace_back(64, 'a');
+    });
+
+    List<Counted> built = make_list(N, true);
+    count_ops("List returned by value     ", N, [&]() {
+        List<Counted> l = make_list(N, true);
+        sink = sink + l.size;
+    });
+    List<Counted> moved;
+    count_ops("moved = std::move(built)   ", N, [&]() {
+        moved = std::move(built); // O(1) : only head , tail and size change hands
+        sink = sink + moved.size;
+    });
+
+    // 1000 lists of 1000 elements pushed into a Vector : it grows (and moves its lists) about 10 times
+    count_ops("Vector<List<Counted>> grows", N, [&]() {
+        Vector<List<Counted>> v;
+        for (int i = 0; i < 1000; i++)
+        {
+            List<Counted> l;
+            for (int j = 0; j < 1000; j++)
+                l.emplace_back(64, 'a');
+            v.push_back(std::move(l));
+        }
+    });
+    std::cout << std::endl;
+}
+
+int main()
+{
+    bench_alloc();
+    bench_sort();
+    bench_moves();
+    return 0;
+}
@@ -1,8 +1,43 @@
 #include <iostream>
+#include <string>
+#include <thread>
+#include <utility>
 #include "Singly_List.hpp"
 
 using namespace std;
 
+//(key , tag) pairs : the tags show where every element ended up , and in which order equal keys came out
+using Tagged = pair<int, char>;
+
+bool by_key(const Tagged& a, const Tagged& b)
+{
+    return a.first < b.first;
+}
+
+template <typename L>
+string tags(L& l)
+{
+    string s;
+    for(const Tagged& p : l)
+        s += p.second;
+    return s;
+}
+
+bool check(const string& what, const string& got, const string& expected)
+{
+    cout<<what<<" : "<<got<<endl;
+    if(got != expected)
+    {
+        cerr<<"FAILED : "<<what<<" gave "<<got<<" , expected "<<expected<<endl;
+        return false;
+    }
+    return true;
+}
+
+//Still holds nodes when main returns : it is destroyed after main's node cache , so its nodes go
+//straight back to the shared pool (run with -fsanitize=address to check)
+List<int> kept;
+
 int main()
 {
     List<string> l1;
@@ -23,7 +58,8 @@ int main()
     }
     cout<<endl;
 
-    l1.append_shared(l2);
+    //append_shared() would make l1 and l2 own the same nodes , and join() below would then link l2 to itself
+    l1.append(l2);
     cout<<l1<<endl;
     l1.join(l2);
     cout<<l2<<endl;
@@ -38,7 +74,62 @@ int main()
     l2.print_list();
     l2.selectionSort();
     l2.print_list();
-    cout<<"\n"<<l2.size;
-    return 0;
+    cout<<"\n"<<l2.size<<endl;
+
+    //Building in place and moving : no string is copied below
+    List<string> l3;
+    l3.emplace_back(3, 'z');                      //"zzz" is built inside the node
+    l3.emplace_front("first");
+    l3.emplace_after(l3.begin(), "second");
+    l3.push_back_list(string("moved in"));
+    List<string> l4 = std::move(l3);              //l4 takes the nodes , l3 is empty now
+    cout<<l4<<l3.size<<endl;                      //first second zzz moved in , 0
+
+    //sort and merge , checked : main returns 1 if any result is wrong
+    bool failed = false;
+
+    //Stable sort with a comparator : equal keys keep the order they were added in
+    List<Tagged> sorted;
+    const int keys[] = {3, 1, 3, 2, 1, 3};
+    for(int i = 0; i < 6; i++)
+        sorted.push_back_list(Tagged(keys[i], 'a' + i));
+    sorted.sort(by_key);
+    sorted.push_back_list(Tagged(0, 'z'));       //Lands last only if sort left tail on the last node
+    failed |= !check("sort", tags(sorted), "bedacfz");
+
+    //merge relinking nodes (same pool) : ties keep this list's element first
+    List<Tagged> ours, theirs;
+    for(Tagged p : {Tagged(1, 'a'), Tagged(4, 'b'), Tagged(9, 'c')})
+        ours.push_back_list(p);
+    for(Tagged p : {Tagged(0, 'd'), Tagged(4, 'e'), Tagged(12, 'f')})
+        theirs.push_back_list(p);
+    ours.merge(theirs, by_key);
+    ours.push_back_list(Tagged(13, 'z'));
+    failed |= !check("merge", tags(ours), "dabecfz") || theirs.size != 0;
+
+    //merge between two lists on their own NodePools : other's nodes can't be relinked , so its values are copied
+    NodePool pool_a(sizeof(Node<Tagged>), alignof(Node<Tagged>));
+    NodePool pool_b(sizeof(Node<Tagged>), alignof(Node<Tagged>));
+    List<Tagged, PoolAllocator<Tagged>> in_a{PoolAllocator<Tagged>(pool_a)};
+    List<Tagged, PoolAllocator<Tagged>> in_b{PoolAllocator<Tagged>(pool_b)};
+    for(Tagged p : {Tagged(1, 'a'), Tagged(4, 'b'), Tagged(4, 'c'), Tagged(9, 'd')})
+        in_a.push_back_list(p);
+    for(Tagged p : {Tagged(0, 'e'), Tagged(4, 'f'), Tagged(5, 'g'), Tagged(12, 'h')})
+        in_b.push_back_list(p);
+    in_a.merge(in_b, by_key);
+    in_a.push_back_list(Tagged(13, 'z'));         //Lands last only if merge moved tail to h's copy
+    failed |= !check("merge , two pools", tags(in_a), "eabcfgdhz") || in_b.size != 0;
+
+    //Lists that outlive the node cache of their thread
+    for(int i = 0; i < 200; i++)
+        kept.push_back_list(i);
+    thread t([]
+    {
+        thread_local List<int> mine;               //Made before the cache , so destroyed after it
+        for(int i = 0; i < 200; i++)
+            mine.push_back_list(i);
+    });
+    t.join();
+    return failed ? 1 : 0;
 
 }
@@ -0,0 +1,586 @@
+#pragma once
+#include <iostream>
+#include <memory>
+#include <new>
+#include <utility>
+#include "../../Allocator/NodePool.hpp"
+
+using namespace std;
+
+// Unrolled Linked List : a linked list where every node holds a small ARRAY of elements instead of one.
+// In List<T> every element is its own node , so walking n elements follows n pointers , and every pointer
+// can be a cache miss (the CPU waits ~100 ns for memory each time).
+// Here a node holds up to N elements side by side (N is picked so a node is about 4 cache lines) :
+// walking the list reads whole arrays , which the CPU prefetches , and follows only n / N pointers.
+// It also uses less memory : one next pointer per N elements instead of one per element.
+// Rules that keep it that way :
+// - insert into a full node : the node is split in two half full nodes , then the element goes in
+// - remove_node / pop_front_list from a node that gets less than half full : it takes elements from (or merges
+//   with) the next node
+// That is not a promise that every node is half full : push_front_list starts a fresh 1 element head node when
+// the head is full , and pop_back_list / remove_node_val only drop nodes that became empty.
+// Same functions as List<T> (push / pop / insert_node / remove_node / join / Iterator ...).
+// Nodes come from PoolAllocator by default , like List<T>.
+template <typename T>
+constexpr int unrolled_capacity()
+{
+    return sizeof(T) * 4 >= 240 ? 4 : (int)(240 / sizeof(T)); // About 256 bytes per node , at least 4 elements
+}
+
+template <typename T, int N = unrolled_capacity<T>()>
+class UNode
+{
+public:
+    UNode<T, N>* next;
+    int count;   //Elements alive in items()[0 .. count)
+    alignas(T) unsigned char storage[N * sizeof(T)];   //Raw memory , elements are constructed only when added
+
+    UNode(UNode<T, N>* n = nullptr) : next(n), count(0) {}
+
+    T* items()
+    {
+        return std::launder(reinterpret_cast<T*>(storage));
+    }
+    const T* items() const
+    {
+        return std::launder(reinterpret_cast<const T*>(storage));
+    }
+
+    //Puts val at position i , moving the elements after it one step right (node must not be full)
+    void insert_at(int i, const T& val)
+    {
+        T* a = items();
+        if (i == count)
+        {
+            ::new ((void*)(a + count)) T(val);
+        }
+        else
+        {
+            T copy(val);   //val may live inside this node
+            ::new ((void*)(a + count)) T(std::move(a[count - 1]));
+            for (int j = count - 1; j > i; j--)
+            {
+                a[j] = std::move(a[j - 1]);
+            }
+            a[i] = std::move(copy);
+        }
+        count++;
+    }
+
+    //Removes the element at i , moving the elements after it one step left
+    void erase_at(int i)
+    {
+        T* a = items();
+        for (int j = i; j < count - 1; j++)
+        {
+            a[j] = std::move(a[j + 1]);
+        }
+        a[count - 1].~T();
+        count--;
+    }
+
+    //Moves elements [from , count) to the end of other
+    void move_tail_to(UNode<T, N>* other, int from)
+    {
+        T* a = items();
+        T* b = other->items();
+        for (int j = from; j < count; j++)
+        {
+            ::new ((void*)(b + other->count)) T(std::move(a[j]));
+            other->count++;
+            a[j].~T();
+        }
+        count = from;
+    }
+
+    void destroy_all()
+    {
+        T* a = items();
+        for (int j = 0; j < count; j++)
+        {
+            a[j].~T();
+        }
+        count = 0;
+    }
+};
+
+template <typename T, typename Alloc = PoolAllocator<T>, int N = unrolled_capacity<T>()>
+class UnrolledList
+{
+    using Node = UNode<T, N>;
+    using NodeAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+    using traits = std::allocator_traits<NodeAlloc>;
+
+    Node* head;
+    Node* tail;
+    [[no_unique_address]] NodeAlloc alloc;
+
+    Node* new_node(Node* next = nullptr)
+    {
+        Node* p = traits::allocate(alloc, 1);
+        traits::construct(alloc, p, next);
+        return p;
+    }
+
+    void free_node(Node* p)
+    {
+        p->destroy_all();
+        traits::destroy(alloc, p);
+        traits::deallocate(alloc, p, 1);
+    }
+
+    //Node holding element ind (0 <= ind < size) , ind becomes the position inside that node
+    Node* find(int& ind) const
+    {
+        Node* temp = head;
+        while (ind >= temp->count)
+        {
+            ind -= temp->count;
+            temp = temp->next;
+        }
+        return temp;
+    }
+
+    //Splits a full node : its upper half moves to a new node right after it
+    void split(Node* node)
+    {
+        Node* half = new_node(node->next);
+        node->move_tail_to(half, node->count / 2);
+        node->next = half;
+        if (tail == node)
+        {
+            tail = half;
+        }
+    }
+
+    //Takes node (with prev before it , or nullptr when node is head) out of the chain and frees it
+    void unlink(Node* prev, Node* node)
+    {
+        if (prev == nullptr)
+        {
+            head = node->next;
+        }
+        else
+        {
+            prev->next = node->next;
+        }
+        if (tail == node)
+        {
+            tail = prev;
+        }
+        free_node(node);
+    }
+
+    //After a removal : a node under half full borrows from the next node , or swallows it when both fit in one
+    void rebalance(Node* prev, Node* node)
+    {
+        if (node->count == 0)
+        {
+            unlink(prev, node);
+            return;
+        }
+        Node* after = node->next;
+        if (node->count >= N / 2 || after == nullptr)
+        {
+            return;
+        }
+        if (node->count + after->count <= N)
+        {
+            after->move_tail_to(node, 0);
+            unlink(node, after);
+        }
+        else
+        {
+            //Borrow the first element of the next node (so both stay in order) , moved , not copied
+            ::new ((void*)(node->items() + node->count)) T(std::move(after->items()[0]));
+            node->count++;
+            after->erase_at(0);
+        }
+    }
+
+public:
+    int size = 0;
+
+    UnrolledList()
+    {
+        head = nullptr;
+        tail = nullptr;
+        size = 0;
+    }
+    explicit UnrolledList(const Alloc& a) : alloc(a)
+    {
+        head = nullptr;
+        tail = nullptr;
+        size = 0;
+    }
+
+    // Elements per node
+    static constexpr int node_capacity()
+    {
+        return N;
+    }
+
+    void push_front_list(const T& val)
+    {
+        if (head == nullptr)
+        {
+            head = tail = new_node();
+        }
+        else if (head->count == N)
+        {
+            head = new_node(head);   //A fresh node in front , the full one stays as it is
+        }
+        head->insert_at(0, val);
+        size++;
+    }
+
+    void push_back_list(const T& val)
+    {
+        if (tail == nullptr)
+        {
+            head = tail = new_node();
+        }
+        else if (tail->count == N)
+        {
+            tail->next = new_node();
+            tail = tail->next;
+        }
+        tail->insert_at(tail->count, val);
+        size++;
+    }
+
+    void pop_front_list()
+    {
+        if (head == nullptr)
+        {
+            cout << "List is empty " << endl;
+            return;
+        }
+        head->erase_at(0);
+        size--;
+        rebalance(nullptr, head);
+    }
+
+    //Only the last node changes , but finding the node before it (if it empties) walks n / N nodes
+    void pop_back_list()
+    {
+        if (head == nullptr)
+        {
+            cout << "List is empty " << endl;
+            return;
+        }
+        tail->erase_at(tail->count - 1);
+        size--;
+        if (tail->count == 0)
+        {
+            Node* prev = nullptr;
+            if (head != tail)
+            {
+                prev = head;
+                while (prev->next != tail)
+                {
+                    prev = prev->next;
+                }
+            }
+            unlink(prev, tail);
+        }
+    }
+
+    void insert_node(const T& val, int ind)
+    {
+        if (ind < 0 || ind > size)
+        {
+            cout << "Invalid Index " << endl;
+            return;
+        }
+        if (ind == size)
+        {
+            push_back_list(val);
+            return;
+        }
+        Node* node = find(ind);
+        if (node->count == N)
+        {
+            split(node);
+            if (ind > node->count)
+            {
+                ind -= node->count;
+                node = node->next;
+            }
+        }
+        node->insert_at(ind, val);
+        size++;
+    }
+
+    void remove_node(int ind)
+    {
+        if (ind < 0 || ind >= size)
+        {
+            cout << "Invalid Size " << endl;
+            return;
+        }
+        Node* prev = nullptr;
+        Node* node = head;
+        while (ind >= node->count)
+        {
+            ind -= node->count;
+            prev = node;
+            node = node->next;
+        }
+        node->erase_at(ind);
+        size--;
+        rebalance(prev, node);
+    }
+
+    //One pass : every node keeps its matching-free elements packed at the front , empty nodes are dropped
+    void remove_node_val(const T& val)
+    {
+        Node* prev = nullptr;
+        Node* node = head;
+        while (node != nullptr)
+        {
+            T* a = node->items();
+            int kept = 0;
+            for (int j = 0; j < node->count; j++)
+            {
+                if (!(a[j] == val))
+                {
+                    if (kept != j)
+                    {
+                        a[kept] = std::move(a[j]);
+                    }
+                    kept++;
+                }
+            }
+            for (int j = kept; j < node->count; j++)
+            {
+                a[j].~T();
+            }
+            size -= node->count - kept;
+            node->count = kept;
+
+            Node* after = node->next;
+            if (kept == 0)
+            {
+                unlink(prev, node);
+            }
+            else
+            {
+                prev = node;
+            }
+            node = after;
+        }
+    }
+
+    int linear_search(const T& target) const //Returns Index
+    {
+        int base = 0;
+        for (Node* node = head; node != nullptr; node = node->next)
+        {
+            const T* a = node->items();
+            for (int j = 0; j < node->count; j++)
+            {
+                if (a[j] == target)
+                {
+                    return base + j;
+                }
+            }
+            base += node->count;
+        }
+        return -1;
+    }
+
+    T at_list(int ind) const
+    {
+        if (ind < 0 || ind >= size)
+        {
+            cout << "Invalid Position " << endl;
+            return T();
+        }
+        Node* node = find(ind);
+        return node->items()[ind];
+    }
+
+    T& operator[](int index)
+    {
+        if (index < 0 || index >= size)
+        {
+            cout << "Invalid Index " << endl;
+        }
+        Node* node = find(index);
+        return node->items()[index];
+    }
+
+    void print_list() const
+    {
+        cout << *this;
+    }
+
+    void clear_list()
+    {
+        Node* node = head;
+        while (node != nullptr)
+        {
+            Node* after = node->next;
+            free_node(node);
+            node = after;
+        }
+        head = tail = nullptr;
+        size = 0;
+    }
+
+    ~UnrolledList()
+    {
+        clear_list();
+    }
+
+    UnrolledList(const UnrolledList& other) : alloc(traits::select_on_container_copy_construction(other.alloc))
+    {
+        head = tail = nullptr;
+        size = 0;
+        append(other);
+    }
+
+    UnrolledList& operator=(const UnrolledList& other)
+    {
+        if (this != &other)
+        {
+            clear_list();
+            append(other);
+        }
+        return *this;
+    }
+
+    friend ostream& operator << (ostream &out, const UnrolledList& list)
+    {
+        for (Node* node = list.head; node != nullptr; node = node->next)
+        {
+            const T* a = node->items();
+            for (int j = 0; j < node->count; j++)
+                out << a[j] << ' ';
+        }
+        out << '\n';
+        return out;
+    }
+
+    bool operator==(const UnrolledList& other) const
+    {
+        if (size != other.size)
+        {
+            return false;
+        }
+        const_walker a(head), b(other.head);
+        for (int i = 0; i < size; i++, a.next(), b.next())
+        {
+            if (a.get() != b.get())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void append(const UnrolledList& other)  //Copy the appending list
+    {
+        int n = other.size;   // Stays right even for l.append(l)
+        const_walker w(other.head);
+        for (int i = 0; i < n; i++, w.next())
+        {
+            push_back_list(w.get());
+        }
+    }
+
+    void join(UnrolledList& other)  //Like std::list::splice : moves all of other's nodes here in O(1) , other becomes empty
+    {
+        if (other.head == nullptr || &other == this)
+        {
+            return;
+        }
+        if (alloc != other.alloc)    // Different pools : our allocator can't free other's nodes , so copy
+        {
+            append(other);
+            other.clear_list();
+            return;
+        }
+        if (head == nullptr)
+        {
+            head = other.head;
+        }
+        else
+        {
+            tail->next = other.head;
+        }
+        tail = other.tail;
+        size += other.size;
+        other.head = other.tail = nullptr;
+        other.size = 0;
+    }
+
+private:
+    //Walks elements one by one (used where an Iterator would need a non const list)
+    struct const_walker
+    {
+        const Node* node;
+        int i;
+        const_walker(const Node* n) : node(n), i(0) {}
+        const T& get() const { return node->items()[i]; }
+        void next()
+        {
+            if (++i == node->count)
+            {
+                node = node->next;
+                i = 0;
+            }
+        }
+    };
+
+public:
+    //Iterator (nested class) : a node and a position inside it
+    class Iterator
+    {
+        Node* node;   //nullptr for end()
+        int i;
+    public:
+        Iterator(Node* n = nullptr, int pos = 0) : node(n), i(pos) {}
+        T& operator*()
+        {
+            return node->items()[i];
+        }
+        T* operator->()
+        {
+            return node->items() + i;
+        }
+        Iterator& operator++()   //Usually just i++ , a pointer is followed only once per N elements
+        {
+            if (++i == node->count)
+            {
+                node = node->next;
+                i = 0;
+            }
+            return (*this);
+        }
+        Iterator operator++(int)
+        {
+            Iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+        bool operator==(const Iterator& it) const
+        {
+            return (node == it.node && i == it.i);
+        }
+        bool operator!=(const Iterator& it) const
+        {
+            return !(*this == it);
+        }
+    };
+
+    Iterator begin()
+    {
+        return Iterator(head, 0);
+    }
+    Iterator end()
+    {
+        return Iterator(nullptr, 0);
+    }
+};
@@ -0,0 +1,87 @@
+#include "UnrolledList.hpp"
+#include "../Singly Linked List/Templated List using 2 Classes (Basic Functions) + Nested Iterator Class/Singly_List.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <vector>
+
+// Benchmarks for UnrolledList.hpp
+// Compile with optimizations on , otherwise the numbers mean nothing :
+// g++ -std=c++17 -O2 -pthread benchmark.cpp -o benchmark
+// ./benchmark          -> 1M and 10M elements
+// ./benchmark 100      -> also 100M elements (needs about 2 GB of RAM)
+
+using Clock = std::chrono::steady_clock;
+
+double ms_since(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// Defeats the optimizer so the lists are really walked
+volatile long long sink = 0;
+
+// Lists built the way real programs build them : pushes mixed with other allocations and frees,
+// so a node-per-element list ends up spread over the heap instead of in one neat block.
+template <typename L>
+void build(L &l, int n)
+{
+    std::vector<int *> noise;
+    for (int i = 0; i < n; i++)
+    {
+        l.push_back_list(i);
+        if (i % 4 == 0)
+            noise.push_back(new int(i));
+        if (noise.size() > 64)
+        {
+            delete noise[(i * 7) % noise.size()];
+            noise[(i * 7) % noise.size()] = noise.back();
+            noise.pop_back();
+        }
+    }
+    for (int *p : noise)
+        delete p;
+}
+
+template <typename L>
+void run(const char *name, int n)
+{
+    L l;
+    auto start = Clock::now();
+    build(l, n);
+    double build_ms = ms_since(start);
+
+    start = Clock::now();
+    long long sum = 0;
+    for (int x : l)
+        sum += x;
+    sink = sink + sum;
+    double walk_ms = ms_since(start);
+
+    start = Clock::now();
+    sink = sink + l.linear_search(-1); // Not there : looks at every element
+    double search_ms = ms_since(start);
+
+    std::cout << "  " << name << " build " << build_ms << " ms | walk " << walk_ms << " ms (" << n / walk_ms / 1000
+              << " M elements/s) | linear_search " << search_ms << " ms" << std::endl;
+}
+
+// --- 1. Full traversal and linear search ---
+void bench_traversal(int n, bool with_plain)
+{
+    std::cout << "--- " << n / 1000000 << "M ints ---" << std::endl;
+    if (with_plain)
+        run<List<int, std::allocator<int>>>("List (new/delete)", n);
+    run<List<int>>("List (node pool)  ", n);
+    run<UnrolledList<int>>("UnrolledList      ", n);
+    std::cout << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    std::cout << "UnrolledList<int> holds " << UnrolledList<int>::node_capacity() << " ints per node" << std::endl;
+    bench_traversal(1000000, true);
+    bench_traversal(10000000, true);
+    if (argc > 1 && atoi(argv[1]) >= 100)
+        bench_traversal(100000000, false); // new/delete nodes would need over 3 GB here
+    return 0;
+}
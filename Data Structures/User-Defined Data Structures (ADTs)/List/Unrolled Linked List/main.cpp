@@ -0,0 +1,52 @@
+#include <iostream>
+#include <string>
+#include "UnrolledList.hpp"
+
+using namespace std;
+
+int main()
+{
+    UnrolledList<int> l1;
+    for (int i = 1; i <= 10; i++)
+    {
+        l1.push_back_list(i * 10);
+    }
+    l1.push_front_list(5);
+    l1.insert_node(55, 6);
+    cout << l1;                                   // 5 10 20 30 40 50 55 60 70 80 90 100
+    cout << "Elements per node : " << UnrolledList<int>::node_capacity() << endl;
+
+    l1.remove_node(0);
+    l1.remove_node_val(55);
+    l1.pop_back_list();
+    cout << l1;                                   // 10 20 30 40 50 60 70 80 90
+    cout << "Index of 70 : " << l1.linear_search(70) << " , l1[3] = " << l1[3] << endl;
+
+    //Same Iterator use as List<T>
+    for (UnrolledList<int>::Iterator it = l1.begin(); it != l1.end(); it++)
+    {
+        *it += 1;
+    }
+    for (int x : l1)
+    {
+        cout << x << " ";
+    }
+    cout << endl;
+
+    //Small nodes (4 strings each , so under 2 is under half full) to see splitting , borrowing and merging at work
+    UnrolledList<string, PoolAllocator<string>, 4> l2;
+    l2.push_back_list("banana");
+    l2.push_back_list("apple");
+    l2.push_back_list("cherry");
+    l2.push_back_list("date");                    // [banana apple cherry date]
+    l2.insert_node("Avocado", 1);                  // Full , so it splits : [banana Avocado apple] [cherry date]
+    l2.push_back_list("elder");
+    l2.push_back_list("fig");                     // [banana Avocado apple] [cherry date elder fig]
+    l2.remove_node(0);                            // [Avocado apple] : still half full
+    l2.remove_node(0);                            // [apple] , 1 + 4 don't fit in one node : borrows , [apple cherry] [date elder fig]
+    l2.remove_node(1);                            // [apple] , 1 + 3 fit : merges , [apple date elder fig]
+    UnrolledList<string, PoolAllocator<string>, 4> l3(l2);
+    l2.join(l3);                                  // O(1) , l3 is now empty
+    cout << l2 << l2.size << " " << l3.size << endl;  // apple date elder fig apple date elder fig , 8 0
+    return 0;
+}
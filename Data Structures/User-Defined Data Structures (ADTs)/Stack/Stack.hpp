@@ -2,6 +2,8 @@
 #include <iostream>
 #include <stdexcept>
 #include <initializer_list> 
+#include <memory>
+#include <utility>
 
 using namespace std;
 
@@ -42,57 +44,72 @@ using namespace std;
 // But we make a topindex that points to the last element in the array.
 // We could also have implemented in such a way that our stack worked like that of vector , list , deque like the built-in one.
 // For that we use a technique called template template parameters. 
-template <typename T> 
+
+// Memory comes from Alloc (std::allocator by default) through std::allocator_traits , same as our Vector.hpp.
+// So the stack can live in an arena : Stack<int, ArenaAllocator<int>> s(ArenaAllocator<int>(arena));
+// Like Vector , only [0 , topIndex] hold real objects , the rest of the array is raw memory.
+template <typename T, typename Alloc = std::allocator<T>> 
 class Stack
 {
 private:
+    using traits = std::allocator_traits<Alloc>;
+
     T *arr;        // Changed to T* for templating
     int topIndex; 
     int CAP;
+    [[no_unique_address]] Alloc alloc; // Empty allocators (like std::allocator) take no space
 
-    void reserve(int new_cap)
+    T *allocate(int n)
     {
-        if (new_cap <= CAP)
-            return;
-
-        T *temp = nullptr;
         try
         {
-            temp = new T[new_cap]; // Allocation for type T
+            return traits::allocate(alloc, n); // Raw memory for type T , no constructors run
         }
         catch (const std::bad_alloc &)
         {
             throw std::runtime_error("Stack: Allocation failed.");
         }
+    }
+
+    void reserve(int new_cap)
+    {
+        if (new_cap <= CAP)
+            return;
+
+        T *temp = allocate(new_cap);
 
         int current_count = topIndex + 1;
         for (int i = 0; i < current_count; i++)
         {
             // Using std::move like your Vector.hpp for efficiency
-            temp[i] = std::move(arr[i]);
+            traits::construct(alloc, temp + i, std::move(arr[i]));
+            traits::destroy(alloc, arr + i);
         }
 
-        delete[] arr;
+        traits::deallocate(alloc, arr, CAP);
         arr = temp;
         CAP = new_cap;
     }
 
 public:
     // Standard Constructor
-    Stack(int initial_cap = 1)
+    Stack(int initial_cap = 1, const Alloc &a = Alloc()) : alloc(a)
     {
         CAP = (initial_cap > 0) ? initial_cap : 1;
         topIndex = -1;
-        arr = new T[CAP];
+        arr = allocate(CAP);
     }
 
+    // Empty stack that takes its memory from a (e.g an arena)
+    explicit Stack(const Alloc &a) : Stack(1, a) {}
+
     // Initializer List Constructor
     // This allows: Stack<int> s = {1, 2, 3};
-    Stack(std::initializer_list<T> list)
+    Stack(std::initializer_list<T> list, const Alloc &a = Alloc()) : alloc(a)
     {
         int list_size = list.size();
         CAP = (list_size > 0) ? list_size : 1;
-        arr = new T[CAP];
+        arr = allocate(CAP);
         topIndex = -1;
 
         for (const T &item : list)
@@ -103,7 +120,11 @@ public:
 
     ~Stack()
     {
-        delete[] arr;
+        for (int i = 0; i <= topIndex; i++)
+        {
+            traits::destroy(alloc, arr + i);
+        }
+        traits::deallocate(alloc, arr, CAP);
     }
 
     void push(T val)
@@ -112,8 +133,8 @@ public:
         {
             reserve(CAP * 2);
         }
+        traits::construct(alloc, arr + topIndex + 1, std::move(val));
         topIndex++;
-        arr[topIndex] = val;
     }
 
     void pop()
@@ -122,6 +143,7 @@ public:
         {
             throw std::out_of_range("Stack Underflow");
         }
+        traits::destroy(alloc, arr + topIndex);
         topIndex--;
     }
 
@@ -166,6 +188,12 @@ public:
         int tempCap = this->CAP;
         this->CAP = other.CAP;
         other.CAP = tempCap;
+
+        // Each array must stay with the allocator that made it
+        if constexpr (traits::propagate_on_container_swap::value)
+        {
+            std::swap(this->alloc, other.alloc);
+        }
     }
 
     int status() const
@@ -199,7 +227,7 @@ public:
     // This displays from bottom to top.
     // Chronological order of how data items were added.
     // Global friend operator for output
-    friend std::ostream &operator<<(std::ostream &out, const Stack<T> &s)
+    friend std::ostream &operator<<(std::ostream &out, const Stack &s)
     {
         for (int i = 0; i <= s.topIndex; i++)
         {
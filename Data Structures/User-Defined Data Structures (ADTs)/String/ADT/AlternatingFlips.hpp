@@ -0,0 +1,148 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "StringView.hpp"
+
+// Minimum flips to make a binary string alternating ("0101..." or "1010...") , the library version of
+// minOperations() in "../minimum flips to make alternating strings O(1) Space and O(n) Time .cpp".
+// That one takes a std::string BY VALUE (a full copy of the input) and tests i % 2 with two branches per char.
+// Here the input is a StringView (no copy) and the work is done 32 or 64 chars at a time :
+// the chars are XORed with the pattern "0101..." , so a char that matches it becomes 0 and a char that matches
+// "1010..." becomes 1 ('0' ^ '1' == 1). Comparing with 0 and with 1 gives one bit per char (movemask),
+// and popcount of those bits counts the matches of both patterns at once. Flips = length - matches.
+// Any char that is neither '0' nor '1' counts as a flip for both patterns , exactly like the original.
+// AVX2 (64 chars per step) is picked at runtime , SSE2 (32 per step) otherwise , plain loop on other CPUs.
+// min_flips_parallel() splits huge inputs between threads (each part's pattern depends on where it starts).
+class AlternatingFlips
+{
+public:
+    // Flips needed for each of the two patterns
+    struct Counts
+    {
+        size_t to_01; // To get "0101..."
+        size_t to_10; // To get "1010..."
+        size_t min() const { return to_01 < to_10 ? to_01 : to_10; }
+    };
+
+    static Counts count(StringView s)
+    {
+        size_t m01, m10;
+        matches(s.data(), s.size(), m01, m10);
+        return Counts{s.size() - m01, s.size() - m10};
+    }
+
+    static size_t min_flips(StringView s) { return count(s).min(); }
+
+    // Same answer , the input is cut into one part per thread. threads = 0 : one per CPU core.
+    // Below 1 MB per thread , starting threads costs more than it saves , so fewer threads are used.
+    static Counts count_parallel(StringView s, unsigned threads = 0)
+    {
+        if (threads == 0)
+            threads = std::thread::hardware_concurrency();
+        size_t max_threads = s.size() / MIN_PART + 1;
+        if (threads > max_threads)
+            threads = (unsigned)max_threads;
+        if (threads <= 1)
+            return count(s);
+
+        // Even sized parts , so every part starts at an even index and sees the pattern from its start
+        size_t part = ((s.size() + threads - 1) / threads + 1) & ~(size_t)1; // Rounded UP to even , so the parts cover everything
+        std::vector<size_t> m01(threads, 0), m10(threads, 0);
+        std::vector<std::thread> workers;
+        workers.reserve(threads - 1);
+        for (unsigned t = 1; t < threads; t++)
+        {
+            size_t from = t * part;
+            size_t len = from >= s.size() ? 0 : (s.size() - from < part ? s.size() - from : part);
+            workers.emplace_back([&, t, from, len]
+                                 { matches(s.data() + from, len, m01[t], m10[t]); });
+        }
+        matches(s.data(), part < s.size() ? part : s.size(), m01[0], m10[0]); // This thread does the first part
+        for (std::thread &w : workers)
+            w.join();
+
+        size_t a = 0, b = 0;
+        for (unsigned t = 0; t < threads; t++)
+        {
+            a += m01[t];
+            b += m10[t];
+        }
+        return Counts{s.size() - a, s.size() - b};
+    }
+
+    static size_t min_flips_parallel(StringView s, unsigned threads = 0) { return count_parallel(s, threads).min(); }
+
+private:
+    static const size_t MIN_PART = 1 << 20;
+
+    // Chars of p[0..n) that match "0101..." (m01) and "1010..." (m10) , p[0] being an even position
+    static void matches(const char *p, size_t n, size_t &m01, size_t &m10)
+    {
+        size_t a = 0, b = 0, i = 0;
+#if defined(STRING_KERNELS_AVX2)
+        if (n >= 64 && StringKernels::has_avx2())
+            i = matches_avx2(p, n, a, b);
+        else
+#endif
+#if defined(__SSE2__)
+            i = matches_sse2(p, n, a, b);
+#endif
+        // Tail (and everything without SSE2) : i is even here , so i % 2 is the pattern position
+        for (; i < n; i++)
+        {
+            char want = (i & 1) ? '1' : '0';
+            a += p[i] == want;
+            b += p[i] == (want ^ 1);
+        }
+        m01 = a;
+        m10 = b;
+    }
+
+#if defined(__SSE2__)
+    // 32 chars per step : two 16 byte vectors , their two 16 bit masks joined into one 32 bit popcount
+    static size_t matches_sse2(const char *p, size_t n, size_t &a, size_t &b)
+    {
+        const __m128i pattern = _mm_set1_epi16(0x3130); // "01" repeated (little endian : '0' first)
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i one = _mm_set1_epi8(1);
+        size_t i = 0;
+        for (; i + 32 <= n; i += 32)
+        {
+            __m128i x0 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(p + i)), pattern);
+            __m128i x1 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(p + i + 16)), pattern);
+            uint32_t z = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(x0, zero)) |
+                         ((uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(x1, zero)) << 16);
+            uint32_t o = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(x0, one)) |
+                         ((uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(x1, one)) << 16);
+            a += __builtin_popcount(z);
+            b += __builtin_popcount(o);
+        }
+        return i;
+    }
+#endif
+
+#if defined(STRING_KERNELS_AVX2)
+    // 64 chars per step : two 32 byte vectors , their masks joined into one 64 bit popcount
+    __attribute__((target("avx2,popcnt"))) static size_t matches_avx2(const char *p, size_t n, size_t &a, size_t &b)
+    {
+        const __m256i pattern = _mm256_set1_epi16(0x3130);
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i one = _mm256_set1_epi8(1);
+        size_t i = 0;
+        for (; i + 64 <= n; i += 64)
+        {
+            __m256i x0 = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(p + i)), pattern);
+            __m256i x1 = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(p + i + 32)), pattern);
+            uint64_t z = (uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(x0, zero)) |
+                         ((uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(x1, zero)) << 32);
+            uint64_t o = (uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(x0, one)) |
+                         ((uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(x1, one)) << 32);
+            a += __builtin_popcountll(z);
+            b += __builtin_popcountll(o);
+        }
+        return i;
+    }
+#endif
+};
@@ -0,0 +1,242 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <system_error>
+#include <charconv>
+
+// Number <-> text conversions that never allocate and never throw (same contract as std::to_chars / std::from_chars).
+// They write into / read from a char range [first , last) that the caller owns , e.g a stack buffer
+// or the end of a String , and report errors through std::errc in the returned struct :
+// to_chars   : {ptr one past the last char written , errc()} or {last , errc::value_too_large}
+// from_chars : {ptr one past the last char used , errc()} , or errc::invalid_argument (no number there)
+//              or errc::result_out_of_range (value doesn't fit , value is left unchanged)
+// Exposed to users as String::to_chars / String::from_chars (See String.hpp).
+
+// Integers (every width , signed or unsigned) :
+// The old way is one division per digit and then reversing the buffer.
+// Here we first count the digits so we can write straight into place from the right , and we emit TWO digits per
+// division using a 200 char table "000102...9899" (v % 100 is the index). Half the divisions , no reverse.
+
+// Doubles :
+// Formatting gives the SHORTEST text that reads back as exactly the same double (e.g 0.1 -> "0.1" , not
+// "0.10000000000000001"). That needs the Ryu algorithm and its big tables , which the standard library
+// already ships in std::to_chars , so we use it. Parsing has our own fast path (Clinger) :
+// if the digits fit in 53 bits and the power of 10 is at most 22 , both are exact doubles and a single
+// multiply / divide gives the correctly rounded answer. That covers almost all real data (prices , metrics , ...).
+// Anything else (long mantissas , huge exponents , inf , nan) goes to std::from_chars.
+class CharConv
+{
+public:
+    // --- INTEGERS ---
+    template <typename T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value, int>::type = 0>
+    static std::to_chars_result to_chars(char *first, char *last, T value)
+    {
+        using U = typename std::make_unsigned<T>::type;
+        U u = (U)value;
+        if constexpr (std::is_signed<T>::value)
+        {
+            if (value < 0)
+            {
+                if (first == last)
+                    return {last, std::errc::value_too_large};
+                *first++ = '-';
+                u = (U)0 - u; // Works for the minimum value too , where -value would overflow
+            }
+        }
+
+        // 32 bit math is cheaper , so small types use it
+        if constexpr (sizeof(U) <= 4)
+            return write_unsigned(first, last, (uint32_t)u);
+        else
+            return write_unsigned(first, last, (uint64_t)u);
+    }
+
+    template <typename T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value, int>::type = 0>
+    static std::from_chars_result from_chars(const char *first, const char *last, T &value)
+    {
+        using U = typename std::make_unsigned<T>::type;
+        const char *p = first;
+        bool neg = false;
+        if constexpr (std::is_signed<T>::value)
+        {
+            if (p != last && *p == '-')
+            {
+                neg = true;
+                p++;
+            }
+        }
+
+        // Biggest magnitude allowed , e.g 128 for a negative int8_t
+        U limit = (U)std::numeric_limits<T>::max() + (neg ? 1 : 0);
+        U acc = 0;
+
+        // The first digits10 digits can't overflow U , so no checks at all for them
+        const char *start = p;
+        const size_t safe = std::numeric_limits<U>::digits10;
+        const char *safe_end = (size_t)(last - p) > safe ? p + safe : last;
+        for (; p != safe_end && is_digit(*p); p++)
+            acc = acc * 10 + (U)(*p - '0');
+        if (p == start)
+            return {first, std::errc::invalid_argument};
+
+        // Longer numbers : check every step , but keep going to the last digit (ptr must end after the number)
+        bool overflow = false;
+        for (; p != last && is_digit(*p); p++)
+        {
+            U d = (U)(*p - '0');
+            if (overflow || acc > (limit - d) / 10)
+                overflow = true;
+            else
+                acc = acc * 10 + d;
+        }
+        if (overflow || acc > limit)
+            return {p, std::errc::result_out_of_range};
+
+        value = neg ? (T)((U)0 - acc) : (T)acc;
+        return {p, std::errc()};
+    }
+
+    // --- DOUBLES ---
+    static std::to_chars_result to_chars(char *first, char *last, double value)
+    {
+        return std::to_chars(first, last, value); // Shortest round trip (Ryu)
+    }
+
+    static std::from_chars_result from_chars(const char *first, const char *last, double &value)
+    {
+        const char *p = first;
+        bool neg = false;
+        if (p != last && *p == '-')
+        {
+            neg = true;
+            p++;
+        }
+
+        uint64_t mantissa = 0;
+        int digits = 0;    // Significant digits in mantissa (leading zeros don't count)
+        int exp10 = 0;     // value = mantissa * 10^exp10
+        bool any = false;  // Saw at least one digit
+
+        for (; p != last && is_digit(*p); p++)
+        {
+            any = true;
+            if (mantissa == 0 && *p == '0')
+                continue;
+            if (++digits > 19) // Doesn't fit in 64 bits
+                return std::from_chars(first, last, value);
+            mantissa = mantissa * 10 + (*p - '0');
+        }
+        if (p != last && *p == '.')
+        {
+            for (p++; p != last && is_digit(*p); p++)
+            {
+                any = true;
+                exp10--;
+                if (mantissa == 0 && *p == '0')
+                    continue;
+                if (++digits > 19)
+                    return std::from_chars(first, last, value);
+                mantissa = mantissa * 10 + (*p - '0');
+            }
+        }
+        if (!any)
+            return std::from_chars(first, last, value); // inf , nan or not a number at all
+
+        // Exponent is optional , "1e" or "1e+" just ends the number before the 'e'
+        if (p != last && (*p == 'e' || *p == 'E'))
+        {
+            const char *q = p + 1;
+            bool exp_neg = false;
+            if (q != last && (*q == '+' || *q == '-'))
+                exp_neg = *q++ == '-';
+            if (q != last && is_digit(*q))
+            {
+                int e = 0;
+                for (; q != last && is_digit(*q); q++)
+                {
+                    if (e < 100000)
+                        e = e * 10 + (*q - '0');
+                }
+                exp10 += exp_neg ? -e : e;
+                p = q;
+            }
+        }
+
+        if (mantissa == 0)
+        {
+            value = neg ? -0.0 : 0.0;
+            return {p, std::errc()};
+        }
+        // Clinger's fast path : mantissa and 10^|exp10| are both exact , one rounding in total
+        if (mantissa <= (uint64_t(1) << 53) && exp10 >= -22 && exp10 <= 22)
+        {
+            double d = (double)mantissa;
+            d = exp10 < 0 ? d / POW10[-exp10] : d * POW10[exp10];
+            value = neg ? -d : d;
+            return {p, std::errc()};
+        }
+        return std::from_chars(first, last, value);
+    }
+
+private:
+    static bool is_digit(char c) { return c >= '0' && c <= '9'; }
+
+    // "00" "01" ... "99" , two chars per entry
+    static constexpr char DIGITS[201] =
+        "0001020304050607080910111213141516171819"
+        "2021222324252627282930313233343536373839"
+        "4041424344454647484950515253545556575859"
+        "6061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+
+    static constexpr double POW10[23] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                         1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+    // Compares against powers of 10 , 4 digits per loop instead of one division per digit
+    template <typename U>
+    static unsigned count_digits(U v)
+    {
+        unsigned n = 1;
+        while (true)
+        {
+            if (v < 10)
+                return n;
+            if (v < 100)
+                return n + 1;
+            if (v < 1000)
+                return n + 2;
+            if (v < 10000)
+                return n + 3;
+            v /= 10000;
+            n += 4;
+        }
+    }
+
+    template <typename U>
+    static std::to_chars_result write_unsigned(char *first, char *last, U v)
+    {
+        unsigned n = count_digits(v);
+        if ((size_t)(last - first) < n)
+            return {last, std::errc::value_too_large};
+
+        char *p = first + n; // Fill from the right , two digits at a time
+        while (v >= 100)
+        {
+            unsigned i = (unsigned)(v % 100) * 2;
+            v /= 100;
+            *--p = DIGITS[i + 1];
+            *--p = DIGITS[i];
+        }
+        if (v >= 10)
+        {
+            unsigned i = (unsigned)v * 2;
+            *--p = DIGITS[i + 1];
+            *--p = DIGITS[i];
+        }
+        else
+            *--p = (char)('0' + v);
+        return {first + n, std::errc()};
+    }
+};
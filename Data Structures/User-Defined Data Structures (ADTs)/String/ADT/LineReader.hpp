@@ -0,0 +1,174 @@
+#pragma once
+#include <cstdio>
+#include <cstring>
+#include <istream>
+#include <stdexcept>
+#include "String.hpp"
+
+// LineReader : reads a text file line by line through one big buffer.
+// Reading with iostreams into a String per line costs a String (and often an allocation) per line.
+// Here the file is read in large blocks (1 MB by default) with fread , and next() hands out each line
+// as a StringView INTO that buffer : no allocation and no copy per line.
+// The view is only valid until the next call , copy it (String(view)) or use getline() to keep it.
+// Usage :
+// LineReader in("data.csv");
+// StringView line;
+// while (in.next(line))
+//     for (StringView field : split(line, ','))
+//         ...
+// Line ends : "\n" and "\r\n" are both removed. The last line doesn't need a '\n'.
+class LineReader
+{
+private:
+    FILE *file;
+    char *buf;
+    size_t cap;
+    size_t begin;   // Start of the next line in buf
+    size_t end;     // End of valid bytes in buf
+    size_t scanned; // Bytes after begin already known to have no '\n' (so a long line is never rescanned)
+    bool eof;
+    size_t lines;
+
+    // Moves the unfinished line to the front and reads more after it. Returns false at end of file.
+    bool refill()
+    {
+        if (begin > 0)
+        {
+            memmove(buf, buf + begin, end - begin);
+            end -= begin;
+            begin = 0;
+        }
+        if (end == cap)
+        {
+            // One line is longer than the whole buffer : grow it (geometric , like String)
+            char *bigger = new char[cap * 2];
+            memcpy(bigger, buf, end);
+            delete[] buf;
+            buf = bigger;
+            cap *= 2;
+        }
+        size_t got = fread(buf + end, 1, cap - end, file);
+        if (got == 0)
+        {
+            if (ferror(file))
+                throw std::runtime_error("LineReader: Read failed");
+            eof = true;
+            return false;
+        }
+        end += got;
+        return true;
+    }
+
+    static StringView strip_cr(const char *p, size_t n)
+    {
+        if (n > 0 && p[n - 1] == '\r')
+            n--;
+        return StringView(p, n);
+    }
+
+public:
+    explicit LineReader(const char *path, size_t buffer_size = 1 << 20)
+        : buf(nullptr), cap(buffer_size > 16 ? buffer_size : 16), begin(0), end(0), scanned(0), eof(false), lines(0)
+    {
+        file = fopen(path, "rb");
+        if (!file)
+            throw std::runtime_error("LineReader: Cannot open file");
+        setvbuf(file, nullptr, _IONBF, 0); // We already read big blocks , a second buffer would only copy twice
+        buf = new char[cap];
+    }
+
+    // Owns a FILE and a buffer
+    LineReader(const LineReader &) = delete;
+    LineReader &operator=(const LineReader &) = delete;
+
+    ~LineReader()
+    {
+        fclose(file);
+        delete[] buf;
+    }
+
+    // Next line as a view into the buffer (valid until the next call). false when the file is done.
+    bool next(StringView &line)
+    {
+        while (true)
+        {
+            const char *from = buf + begin + scanned;
+            const char *nl = (const char *)memchr(from, '\n', end - begin - scanned);
+            if (nl)
+            {
+                size_t len = nl - (buf + begin);
+                line = strip_cr(buf + begin, len);
+                begin += len + 1;
+                scanned = 0;
+                lines++;
+                return true;
+            }
+            scanned = end - begin;
+
+            if (eof || !refill())
+            {
+                if (begin == end)
+                    return false;
+                line = strip_cr(buf + begin, end - begin); // Last line without '\n'
+                begin = end;
+                scanned = 0;
+                lines++;
+                return true;
+            }
+        }
+    }
+
+    // Copies the next line into out , reusing out's buffer (no allocation once it is big enough)
+    template <typename Alloc, typename Growth>
+    bool getline(BasicString<Alloc, Growth> &out)
+    {
+        StringView line;
+        if (!next(line))
+            return false;
+        out.clear();
+        out.append(line);
+        return true;
+    }
+
+    // Lines returned so far
+    size_t line_number() const { return lines; }
+};
+
+// getline for any std::istream (std::cin , std::ifstream ...) that refills the caller's String instead of
+// making a new one : after the first few lines the buffer is big enough and no allocation happens at all.
+// Same return / flags as std::getline : while (getline(std::cin, s)) ...
+template <typename Alloc, typename Growth>
+std::istream &getline(std::istream &is, BasicString<Alloc, Growth> &out, char delim = '\n')
+{
+    out.clear();
+    // istream::getline scans the stream's own buffer in bulk , we just move its pieces into out
+    char chunk[4096];
+    bool any = false;
+    while (true)
+    {
+        is.getline(chunk, sizeof(chunk), delim);
+        std::streamsize got = is.gcount(); // Includes the delimiter if one was taken
+        if (is.bad())
+            return is;
+
+        if (!is.fail())
+        {
+            // Ended by the delimiter , or by end of file after some chars
+            out.append(StringView(chunk, is.eof() ? got : got - 1));
+            return is;
+        }
+        if (!is.eof())
+        {
+            // chunk was full but the line goes on : keep reading
+            out.append(StringView(chunk, got));
+            any = true;
+            is.clear(is.rdstate() & ~std::ios::failbit);
+            continue;
+        }
+        // End of file with nothing new : fine if this line already had chars (keep only eofbit)
+        out.append(StringView(chunk, got));
+        if (any || got > 0)
+            is.clear(std::ios::eofbit);
+        return is;
+    }
+}
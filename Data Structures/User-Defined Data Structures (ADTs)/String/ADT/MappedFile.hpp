@@ -0,0 +1,112 @@
+#pragma once
+#include <cstddef>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "StringView.hpp"
+
+// MappedFile : a read-only file seen directly as chars in memory (POSIX mmap , Linux / macOS).
+// Loading a big file into a String means reserve + copying every byte from the OS into our buffer,
+// and nothing can be searched before the whole copy is done.
+// With mmap the OS maps the file's pages into our address space instead : constructing is O(1),
+// pages are read from disk (or taken from the page cache) only when first touched , and there is no copy at all.
+// So a search that finds its answer in the first megabyte only ever reads that megabyte.
+// Usage :
+// MappedFile log("app.log");
+// size_t at = log.find("ERROR");       // Or any StringView function on log.view()
+// We also tell the OS the file will be read front to back (madvise SEQUENTIAL) , so it reads ahead
+// more aggressively and drops pages behind us sooner.
+// The views point into the mapping : they are valid only while the MappedFile is alive.
+class MappedFile
+{
+private:
+    const char *_data;
+    size_t _size;
+
+    void unmap()
+    {
+        if (_data)
+            munmap((void *)_data, _size);
+        _data = nullptr;
+        _size = 0;
+    }
+
+public:
+    static const size_t npos = -1;
+
+    explicit MappedFile(const char *path, bool sequential = true) : _data(nullptr), _size(0)
+    {
+        int fd = open(path, O_RDONLY);
+        if (fd < 0)
+            throw std::runtime_error("MappedFile: Cannot open file");
+
+        struct stat st;
+        if (fstat(fd, &st) != 0)
+        {
+            close(fd);
+            throw std::runtime_error("MappedFile: Cannot read file size");
+        }
+        _size = (size_t)st.st_size;
+
+        // mmap of 0 bytes is an error , an empty file is just an empty view
+        if (_size > 0)
+        {
+            void *p = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED)
+            {
+                close(fd);
+                _size = 0;
+                throw std::runtime_error("MappedFile: mmap failed");
+            }
+            _data = (const char *)p;
+            if (sequential)
+                madvise(p, _size, MADV_SEQUENTIAL); // Only a hint , failing is harmless
+        }
+        close(fd); // The mapping keeps the file alive by itself
+    }
+
+    // Only one owner may unmap , so no copies (moving is fine)
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    MappedFile(MappedFile &&other) noexcept : _data(other._data), _size(other._size)
+    {
+        other._data = nullptr;
+        other._size = 0;
+    }
+
+    MappedFile &operator=(MappedFile &&other) noexcept
+    {
+        if (this != &other)
+        {
+            unmap();
+            _data = other._data;
+            _size = other._size;
+            other._data = nullptr;
+            other._size = 0;
+        }
+        return *this;
+    }
+
+    ~MappedFile()
+    {
+        unmap();
+    }
+
+    const char *data() const { return _data ? _data : ""; }
+    size_t size() const { return _size; }
+    bool empty() const { return _size == 0; }
+
+    // The whole file , not '\0' terminated (it is the file's own bytes)
+    StringView view() const { return StringView(data(), _size); }
+    operator StringView() const { return view(); }
+
+    // Search without loading : only the pages the search walks over are read
+    size_t find(StringView s, size_t pos = 0) const { return view().find(s, pos); }
+    size_t find(char c, size_t pos = 0) const { return view().find(c, pos); }
+    size_t rfind(StringView s, size_t pos = npos) const { return view().rfind(s, pos); }
+    bool contains(StringView s) const { return view().contains(s); }
+    StringView substr(size_t pos, size_t len = npos) const { return view().substr(pos, len); }
+};
@@ -0,0 +1,296 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+#include "StringView.hpp"
+#include "AlternatingFlips.hpp"
+
+// Distance of a string to a PERIODIC pattern : the number of chars to change so that s becomes
+// pattern repeated ("abc" -> "abcabcabc..."). AlternatingFlips is the special case "01" / "10".
+// Works for any period k (the pattern's length) and any chars , in one O(n) pass.
+
+// PatternDistance holds several patterns (any periods) and measures all of them in the SAME pass :
+// each 32 byte block of s is loaded once and compared with every pattern's chars for that position
+// (cmpeq + movemask + popcount , AVX2 when the CPU has it , SSE2 otherwise).
+// The trick for any period : every pattern is stored repeated to k + 32 chars , so the 32 chars it expects
+// from any position are one unaligned load at (position % k) , and that offset moves by 32 % k per block.
+// Cost : about n / 32 steps per pattern , so a few hundred patterns are still one memory pass.
+// Usage :
+// PatternDistance d = PatternDistance::rotations("ACGT");  // "ACGT" , "CGTA" , "GTAC" , "TACG"
+// std::vector<size_t> flips = d.distances(dna);             // All four in one pass
+class PatternDistance
+{
+private:
+    struct Pattern
+    {
+        std::vector<char> tiled; // The pattern repeated to period + 32 chars
+        size_t period;
+        size_t step; // 32 % period : how far the offset moves per 32 byte block
+    };
+
+    std::vector<Pattern> patterns;
+
+    static const size_t BLOCK = 32;
+
+    // matches[p] += chars of s[0..n) equal to pattern p's char at the same position
+    void count_matches(const char *s, size_t n, uint64_t *matches) const
+    {
+        size_t m = patterns.size();
+        std::vector<size_t> offset(m, 0);
+        size_t i = 0;
+#if defined(STRING_KERNELS_AVX2)
+        if (n >= BLOCK && StringKernels::has_avx2())
+            i = blocks_avx2(s, n, matches, offset.data());
+        else
+#endif
+#if defined(__SSE2__)
+            i = blocks_sse2(s, n, matches, offset.data());
+#endif
+        // Tail (and everything without SSE2)
+        for (size_t p = 0; p < m; p++)
+        {
+            const char *want = patterns[p].tiled.data();
+            size_t at = offset[p], k = patterns[p].period;
+            for (size_t j = i; j < n; j++)
+            {
+                matches[p] += s[j] == want[at];
+                if (++at == k)
+                    at = 0;
+            }
+        }
+    }
+
+#if defined(__SSE2__)
+    size_t blocks_sse2(const char *s, size_t n, uint64_t *matches, size_t *offset) const
+    {
+        size_t m = patterns.size(), i = 0;
+        for (; i + BLOCK <= n; i += BLOCK)
+        {
+            __m128i x0 = _mm_loadu_si128((const __m128i *)(s + i));
+            __m128i x1 = _mm_loadu_si128((const __m128i *)(s + i + 16));
+            for (size_t p = 0; p < m; p++)
+            {
+                const Pattern &pt = patterns[p];
+                const char *want = pt.tiled.data() + offset[p];
+                uint32_t eq = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(x0, _mm_loadu_si128((const __m128i *)want))) |
+                              ((uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(x1, _mm_loadu_si128((const __m128i *)(want + 16)))) << 16);
+                matches[p] += __builtin_popcount(eq);
+                offset[p] += pt.step;
+                if (offset[p] >= pt.period)
+                    offset[p] -= pt.period;
+            }
+        }
+        return i;
+    }
+#endif
+
+#if defined(STRING_KERNELS_AVX2)
+    __attribute__((target("avx2,popcnt"))) size_t blocks_avx2(const char *s, size_t n, uint64_t *matches, size_t *offset) const
+    {
+        size_t m = patterns.size(), i = 0;
+        for (; i + BLOCK <= n; i += BLOCK)
+        {
+            __m256i x = _mm256_loadu_si256((const __m256i *)(s + i));
+            for (size_t p = 0; p < m; p++)
+            {
+                const Pattern &pt = patterns[p];
+                __m256i want = _mm256_loadu_si256((const __m256i *)(pt.tiled.data() + offset[p]));
+                matches[p] += __builtin_popcount((uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, want)));
+                offset[p] += pt.step;
+                if (offset[p] >= pt.period)
+                    offset[p] -= pt.period;
+            }
+        }
+        return i;
+    }
+#endif
+
+public:
+    PatternDistance() = default;
+    explicit PatternDistance(StringView pattern) { add(pattern); }
+
+    // Adds a pattern , returns its index in distances()
+    size_t add(StringView pattern)
+    {
+        if (pattern.empty())
+            throw std::invalid_argument("PatternDistance: Empty pattern");
+        Pattern p;
+        p.period = pattern.size();
+        p.step = BLOCK % p.period;
+        p.tiled.resize(p.period + BLOCK);
+        for (size_t i = 0; i < p.tiled.size(); i++)
+            p.tiled[i] = pattern[i % p.period];
+        patterns.push_back(std::move(p));
+        return patterns.size() - 1;
+    }
+
+    // All k cyclic shifts of pattern : index j is pattern rotated left by j ("abc" -> "abc" , "bca" , "cab")
+    static PatternDistance rotations(StringView pattern)
+    {
+        PatternDistance d;
+        d.add(pattern);
+        std::vector<char> shifted(pattern.data(), pattern.data() + pattern.size());
+        for (size_t j = 1; j < pattern.size(); j++)
+        {
+            for (size_t i = 0; i < shifted.size(); i++)
+                shifted[i] = pattern[(i + j) % pattern.size()];
+            d.add(StringView(shifted.data(), shifted.size()));
+        }
+        return d;
+    }
+
+    size_t size() const { return patterns.size(); }
+
+    // Changes needed to turn s into each pattern repeated , all patterns in one pass
+    std::vector<size_t> distances(StringView s) const
+    {
+        std::vector<uint64_t> matches(patterns.size(), 0);
+        count_matches(s.data(), s.size(), matches.data());
+        std::vector<size_t> result(patterns.size());
+        for (size_t p = 0; p < patterns.size(); p++)
+            result[p] = s.size() - matches[p];
+        return result;
+    }
+
+    // Smallest of distances(s) (for rotations() : the best alignment of the pattern)
+    size_t min_distance(StringView s) const
+    {
+        if (patterns.empty())
+            throw std::logic_error("PatternDistance: No patterns");
+        std::vector<size_t> all = distances(s);
+        size_t best = all[0];
+        for (size_t d : all)
+            best = d < best ? d : best;
+        return best;
+    }
+
+    // One pattern. "01" and "10" go to AlternatingFlips , which counts both at once with a fixed mask.
+    static size_t distance(StringView s, StringView pattern)
+    {
+        if (pattern.size() == 2 && ((pattern[0] == '0' && pattern[1] == '1') || (pattern[0] == '1' && pattern[1] == '0')))
+        {
+            AlternatingFlips::Counts c = AlternatingFlips::count(s);
+            return pattern[0] == '0' ? c.to_01 : c.to_10;
+        }
+        return PatternDistance(pattern).distances(s)[0];
+    }
+
+    // Fewest changes to match pattern after moving any number of chars from the front of s to its back
+    // ("type-1" operations , i.e. over every rotation of s). With pattern "01" and "10" this is the classic
+    // minimum flips over all rotations of a binary string.
+    static size_t min_over_rotations(StringView s, StringView pattern);
+};
+
+// Streaming version : chars arrive one by one and we want the distance of the LAST window chars.
+// For every alignment j of the pattern we keep the mismatches inside the window , adding the new char
+// and removing the one that falls out of the window : O(k) per char , O(window) memory , no rescanning.
+// Usage :
+// SlidingPatternDistance w("01", 1000);
+// for each char c : w.push(c); if (w.full()) ... w.distance() / w.min_distance()
+class SlidingPatternDistance
+{
+private:
+    std::vector<char> pattern;
+    size_t window;
+    std::vector<char> ring; // The last window chars
+    std::vector<size_t> mismatches; // [j] : window chars that differ from pattern[(position + j) % k]
+    uint64_t pushed;
+
+    // Adds (or removes) the mismatches of char c that sits at absolute position pos
+    void account(char c, uint64_t pos, bool add)
+    {
+        size_t k = pattern.size();
+        size_t at = (size_t)(pos % k); // pattern index for j = 0 , then + 1 per j
+        for (size_t j = 0; j < k; j++)
+        {
+            if (c != pattern[at])
+            {
+                if (add)
+                    mismatches[j]++;
+                else
+                    mismatches[j]--;
+            }
+            if (++at == k)
+                at = 0;
+        }
+    }
+
+public:
+    SlidingPatternDistance(StringView p, size_t window_size)
+        : pattern(p.data(), p.data() + p.size()), window(window_size), ring(window_size), mismatches(p.size(), 0), pushed(0)
+    {
+        if (p.empty())
+            throw std::invalid_argument("SlidingPatternDistance: Empty pattern");
+        if (window_size == 0)
+            throw std::invalid_argument("SlidingPatternDistance: Empty window");
+    }
+
+    void push(char c)
+    {
+        size_t slot = (size_t)(pushed % window);
+        if (pushed >= window)
+            account(ring[slot], pushed - window, false); // Falls out of the window
+        ring[slot] = c;
+        account(c, pushed, true);
+        pushed++;
+    }
+
+    void push(StringView s)
+    {
+        for (size_t i = 0; i < s.size(); i++)
+            push(s[i]);
+    }
+
+    // true once window chars have been pushed
+    bool full() const { return pushed >= window; }
+    uint64_t position() const { return pushed; }
+
+    // Changes needed for the window to be the pattern repeated , the pattern starting at the window's first char
+    size_t distance() const
+    {
+        uint64_t start = pushed > window ? pushed - window : 0;
+        size_t k = pattern.size();
+        return mismatches[(k - start % k) % k]; // j with (start + j) % k == 0
+    }
+
+    // Same , the pattern starting at any of its k positions
+    size_t min_distance() const
+    {
+        size_t best = mismatches[0];
+        for (size_t d : mismatches)
+            best = d < best ? d : best;
+        return best;
+    }
+
+    void clear()
+    {
+        pushed = 0;
+        for (size_t &d : mismatches)
+            d = 0;
+    }
+};
+
+inline size_t PatternDistance::min_over_rotations(StringView s, StringView pattern)
+{
+    if (pattern.empty())
+        throw std::invalid_argument("PatternDistance: Empty pattern");
+    size_t n = s.size(), k = pattern.size();
+    if (n == 0)
+        return 0;
+    // When k divides n , rotating s by t is the same as rotating the pattern by -t : one vectorized pass
+    if (n % k == 0)
+        return rotations(pattern).min_distance(s);
+
+    // Otherwise slide a window of n over s + s (without building it) : window t is s rotated by t
+    SlidingPatternDistance w(pattern, n);
+    w.push(s);
+    size_t best = w.distance();
+    for (size_t t = 1; t < n; t++)
+    {
+        w.push(s[t - 1]);
+        size_t d = w.distance();
+        best = d < best ? d : best;
+    }
+    return best;
+}
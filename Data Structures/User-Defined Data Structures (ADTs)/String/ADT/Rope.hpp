@@ -0,0 +1,334 @@
+#pragma once
+#include <iostream>
+#include <stdexcept>
+#include <cstring>
+#include "String.hpp"
+
+// Rope : a long text that is edited in the middle (like the buffer of a text editor).
+// String::insert / erase in the middle move the whole tail of the text , O(n) per edit.
+// A Rope keeps the text as many small pieces (at most LEAF chars each) in a balanced binary tree,
+// where reading the pieces left to right (in-order) gives the text.
+// Every node also stores the total length of its subtree , so finding "char number pos" walks down one path.
+
+// The tree is a Treap (Tree + Heap) : nodes are ordered by position like a BST , and every node gets a random
+// priority that is kept in heap order. Random priorities keep it balanced with high probability : depth O(log n).
+// Only two operations are needed :
+// split(t , pos) -> the tree of the first pos chars and the tree of the rest
+// merge(a , b)   -> one tree of a followed by b
+// insert(pos , s) = split at pos , merge(left , pieces of s , right)
+// erase(pos , len) = split at pos and pos + len , throw away the middle one , merge the others
+// Both are O(log n) (plus the length of s , which has to be copied anyway).
+class Rope
+{
+private:
+    static const size_t LEAF = 512; // Max chars in one piece
+
+    struct Node
+    {
+        char *text;     // The piece , not '\0' terminated
+        size_t len;     // Chars in this piece
+        size_t total;   // Chars in the whole subtree (left + this + right)
+        unsigned prio;  // Random , parent's prio >= children's
+        Node *left;
+        Node *right;
+    };
+
+    Node *root;
+    unsigned seed;
+    mutable String flat;        // c_str() cache
+    mutable bool flat_ok;
+
+    // --- RANDOM PRIORITIES (xorshift , no need for <random>) ---
+    unsigned next_prio()
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        return seed;
+    }
+
+    static size_t total(Node *t) { return t ? t->total : 0; }
+
+    static void update(Node *t)
+    {
+        t->total = total(t->left) + t->len + total(t->right);
+    }
+
+    Node *make_node(const char *s, size_t n)
+    {
+        Node *t = new Node;
+        t->text = new char[n > 0 ? n : 1]; // Pieces are never grown in place , so exactly n
+        memcpy(t->text, s, n);
+        t->len = t->total = n;
+        t->prio = next_prio();
+        t->left = t->right = nullptr;
+        return t;
+    }
+
+    static void free_tree(Node *t)
+    {
+        if (!t)
+            return;
+        free_tree(t->left);
+        free_tree(t->right);
+        delete[] t->text;
+        delete t;
+    }
+
+    Node *clone(Node *t)
+    {
+        if (!t)
+            return nullptr;
+        Node *c = make_node(t->text, t->len);
+        c->prio = t->prio;
+        c->left = clone(t->left);
+        c->right = clone(t->right);
+        c->total = t->total;
+        return c;
+    }
+
+    // --- THE TWO TREAP OPERATIONS ---
+    // a's chars all come before b's chars
+    static Node *merge(Node *a, Node *b)
+    {
+        if (!a)
+            return b;
+        if (!b)
+            return a;
+        if (a->prio >= b->prio)
+        {
+            a->right = merge(a->right, b);
+            update(a);
+            return a;
+        }
+        b->left = merge(a, b->left);
+        update(b);
+        return b;
+    }
+
+    // l gets the first pos chars of t , r gets the rest. A piece that straddles pos is cut in two.
+    void split(Node *t, size_t pos, Node *&l, Node *&r)
+    {
+        if (!t)
+        {
+            l = r = nullptr;
+            return;
+        }
+        size_t left_len = total(t->left);
+        if (pos <= left_len)
+        {
+            split(t->left, pos, l, t->left);
+            update(t);
+            r = t;
+        }
+        else if (pos >= left_len + t->len)
+        {
+            split(t->right, pos - left_len - t->len, t->right, r);
+            update(t);
+            l = t;
+        }
+        else
+        {
+            // Cut inside this piece : the tail becomes a new node placed first in the right part
+            size_t cut = pos - left_len;
+            Node *tail = make_node(t->text + cut, t->len - cut);
+            tail->prio = t->prio; // Takes t's place above t->right , so it needs a priority as high as t's
+            t->len = cut;
+            tail->right = t->right;
+            t->right = nullptr;
+            update(tail);
+            update(t);
+            l = t;
+            r = tail;
+        }
+    }
+
+    // Turns s into a tree of LEAF sized pieces
+    Node *build(StringView s)
+    {
+        Node *t = nullptr;
+        for (size_t i = 0; i < s.size(); i += LEAF)
+        {
+            size_t n = s.size() - i < LEAF ? s.size() - i : LEAF;
+            t = merge(t, make_node(s.data() + i, n));
+        }
+        return t;
+    }
+
+    template <typename F>
+    static void for_each_piece(Node *t, F &&f)
+    {
+        if (!t)
+            return;
+        for_each_piece(t->left, f);
+        f(t->text, t->len);
+        for_each_piece(t->right, f);
+    }
+
+public:
+    Rope() : root(nullptr), seed(2463534242u), flat_ok(false) {}
+
+    Rope(StringView s) : Rope()
+    {
+        root = build(s);
+    }
+
+    // Rule of 5 : the tree is owned , copies are deep
+    Rope(const Rope &other) : root(nullptr), seed(other.seed), flat_ok(false)
+    {
+        root = clone(other.root);
+    }
+
+    Rope(Rope &&other) noexcept : root(other.root), seed(other.seed), flat_ok(false)
+    {
+        other.root = nullptr;
+        other.flat_ok = false;
+    }
+
+    Rope &operator=(const Rope &other)
+    {
+        if (this != &other)
+        {
+            Node *copy = clone(other.root);
+            free_tree(root);
+            root = copy;
+            flat_ok = false;
+        }
+        return *this;
+    }
+
+    Rope &operator=(Rope &&other) noexcept
+    {
+        if (this != &other)
+        {
+            free_tree(root);
+            root = other.root;
+            other.root = nullptr;
+            other.flat_ok = false;
+            flat_ok = false;
+        }
+        return *this;
+    }
+
+    ~Rope()
+    {
+        free_tree(root);
+    }
+
+    size_t size() const { return total(root); }
+    size_t length() const { return total(root); }
+    bool empty() const { return root == nullptr; }
+
+    // --- MODIFIERS (O(log n) + length of s) ---
+    void insert(size_t pos, StringView s)
+    {
+        if (pos > size())
+            throw std::out_of_range("Rope: Insert error");
+        if (s.empty())
+            return;
+        Node *middle = build(s);
+        Node *l, *r;
+        split(root, pos, l, r);
+        root = merge(merge(l, middle), r);
+        flat_ok = false;
+    }
+
+    void append(StringView s) { insert(size(), s); }
+
+    void erase(size_t pos, size_t len)
+    {
+        if (pos >= size())
+            throw std::out_of_range("Rope: Erase error");
+        if (pos + len > size())
+            len = size() - pos;
+        Node *l, *mid, *r;
+        split(root, pos, l, r);
+        split(r, len, mid, r);
+        free_tree(mid);
+        root = merge(l, r);
+        flat_ok = false;
+    }
+
+    // --- ELEMENT ACCESS (O(log n)) ---
+    char at(size_t idx) const
+    {
+        if (idx >= size())
+            throw std::out_of_range("Rope: Index out of bounds");
+        Node *t = root;
+        while (true)
+        {
+            size_t left_len = total(t->left);
+            if (idx < left_len)
+                t = t->left;
+            else if (idx < left_len + t->len)
+                return t->text[idx - left_len];
+            else
+            {
+                idx -= left_len + t->len;
+                t = t->right;
+            }
+        }
+    }
+
+    char operator[](size_t idx) const { return at(idx); }
+
+    // --- CONVERSIONS ---
+    // Copies chars [pos , pos + len) into a String , only the pieces in range are visited
+    String substr(size_t pos, size_t len = String::npos) const
+    {
+        if (pos > size())
+            throw std::out_of_range("Rope: Substr error");
+        if (len == String::npos || pos + len > size())
+            len = size() - pos;
+        String result;
+        result.reserve(len + 1);
+        append_range(root, pos, len, result);
+        return result;
+    }
+
+    String to_string() const { return substr(0); }
+
+    // Flattens the pieces into one '\0' terminated buffer , kept until the next edit
+    const char *c_str() const
+    {
+        if (!flat_ok)
+        {
+            flat = to_string();
+            flat_ok = true;
+        }
+        return flat.c_str();
+    }
+
+    friend std::ostream &operator<<(std::ostream &os, const Rope &r)
+    {
+        for_each_piece(r.root, [&os](const char *s, size_t n)
+                       { os.write(s, n); });
+        return os;
+    }
+
+private:
+    // Appends the chars of subtree t in [pos , pos + len) to out , skipping subtrees outside the range
+    static void append_range(Node *t, size_t pos, size_t len, String &out)
+    {
+        if (!t || len == 0)
+            return;
+        size_t left_len = total(t->left);
+        if (pos < left_len)
+        {
+            size_t n = left_len - pos < len ? left_len - pos : len;
+            append_range(t->left, pos, n, out);
+            pos = left_len;
+            len -= n;
+        }
+        if (len > 0 && pos < left_len + t->len)
+        {
+            size_t from = pos - left_len;
+            size_t n = t->len - from < len ? t->len - from : len;
+            out.append(StringView(t->text + from, n));
+            pos += n;
+            len -= n;
+        }
+        if (len > 0)
+            append_range(t->right, pos - left_len - t->len, len, out);
+    }
+};
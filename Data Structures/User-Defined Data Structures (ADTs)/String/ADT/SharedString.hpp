@@ -0,0 +1,201 @@
+#pragma once
+#include <iostream>
+#include <atomic>
+#include <new>
+#include <stdexcept>
+#include <cstring>
+#include "String.hpp"
+
+// SharedString : an IMMUTABLE string whose copies share one buffer.
+// Copying a String always copies its chars. For read-mostly data (config values , names , keys) that is
+// passed to hundreds of objects and threads , that is a lot of allocations for the same bytes.
+// Here a copy just adds 1 to a reference count , O(1) , and the last copy to die frees the buffer.
+
+// Layout : ONE allocation holding a small header followed by the chars :
+// [ refs | size | hash | c h a r s ... '\0' ]
+// so there is no second allocation (or pointer chase) for the count , unlike std::shared_ptr<std::string>.
+// The object itself is a single pointer (8 bytes).
+
+// Thread safety : the count is a std::atomic , so copies / destruction of the same SharedString from
+// many threads are safe. The chars are never written after construction , so reading them needs no lock.
+// (Same rules as std::shared_ptr : one SharedString OBJECT shouldn't be assigned in one thread while read in another.)
+class SharedString
+{
+private:
+    struct Header
+    {
+        std::atomic<size_t> refs;
+        size_t size;
+        std::atomic<size_t> hash; // 0 = not computed yet
+
+        char *chars() { return reinterpret_cast<char *>(this + 1); }
+    };
+
+    Header *rep; // nullptr means the empty string , so default construction allocates nothing
+
+    static Header *make(const char *s, size_t n)
+    {
+        if (n == 0)
+            return nullptr;
+        void *mem = nullptr;
+        try
+        {
+            mem = ::operator new(sizeof(Header) + n + 1);
+        }
+        catch (const std::bad_alloc &)
+        {
+            throw std::runtime_error("SharedString: Allocation failed.");
+        }
+        Header *h = new (mem) Header;
+        h->refs.store(1, std::memory_order_relaxed);
+        h->size = n;
+        h->hash.store(0, std::memory_order_relaxed);
+        memcpy(h->chars(), s, n);
+        h->chars()[n] = '\0';
+        return h;
+    }
+
+    void retain() const
+    {
+        // Relaxed is enough : we already hold a reference , so the buffer can't go away under us
+        if (rep)
+            rep->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void drop()
+    {
+        // acq_rel : the thread that frees must see every other thread's last read of the chars
+        if (rep && rep->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            rep->~Header();
+            ::operator delete(rep);
+        }
+        rep = nullptr;
+    }
+
+    StringView view() const { return rep ? StringView(rep->chars(), rep->size) : StringView(); }
+
+public:
+    static const size_t npos = -1;
+
+    // --- CONSTRUCTORS (the only place the chars are copied) ---
+    // explicit , so an allocation never hides inside an expression like shared == "abc"
+    SharedString() : rep(nullptr) {}
+    explicit SharedString(const char *s) : SharedString(StringView(s)) {}
+    explicit SharedString(StringView s) : rep(make(s.data(), s.size())) {}
+    explicit SharedString(const String &s) : rep(make(s.data(), s.size())) {}
+
+    // O(1) copy : just one more owner
+    SharedString(const SharedString &other) : rep(other.rep)
+    {
+        retain();
+    }
+
+    SharedString(SharedString &&other) noexcept : rep(other.rep)
+    {
+        other.rep = nullptr;
+    }
+
+    SharedString &operator=(const SharedString &other)
+    {
+        Header *r = other.rep; // Saved first , other may be *this
+        other.retain();        // Before drop() , in case both share the same buffer
+        drop();
+        rep = r;
+        return *this;
+    }
+
+    SharedString &operator=(SharedString &&other) noexcept
+    {
+        if (this != &other)
+        {
+            drop();
+            rep = other.rep;
+            other.rep = nullptr;
+        }
+        return *this;
+    }
+
+    ~SharedString()
+    {
+        drop();
+    }
+
+    // --- READ API (same names as String) ---
+    size_t size() const { return rep ? rep->size : 0; }
+    size_t length() const { return size(); }
+    bool empty() const { return rep == nullptr; }
+    const char *c_str() const { return rep ? rep->chars() : ""; }
+    const char *data() const { return c_str(); }
+
+    const char &operator[](size_t idx) const { return rep->chars()[idx]; }
+
+    const char &at(size_t idx) const
+    {
+        if (idx >= size())
+            throw std::out_of_range("SharedString: Index out of bounds");
+        return rep->chars()[idx];
+    }
+
+    operator StringView() const { return view(); }
+
+    // How many SharedString objects share this buffer right now (0 for the empty string)
+    size_t use_count() const { return rep ? rep->refs.load(std::memory_order_relaxed) : 0; }
+
+    // Views stay valid as long as any copy of this SharedString is alive
+    StringView substr(size_t pos, size_t len = npos) const { return view().substr(pos, len); }
+
+    size_t find(StringView s, size_t pos = 0) const { return view().find(s, pos); }
+    size_t find(char c, size_t pos = 0) const { return view().find(c, pos); }
+    size_t rfind(StringView s, size_t pos = npos) const { return view().rfind(s, pos); }
+    size_t find_first_of(StringView set, size_t pos = 0) const { return view().find_first_of(set, pos); }
+    size_t find_last_of(StringView set, size_t pos = npos) const { return view().find_last_of(set, pos); }
+    bool contains(StringView s) const { return view().contains(s); }
+    bool starts_with(StringView s) const { return view().starts_with(s); }
+    bool ends_with(StringView s) const { return view().ends_with(s); }
+    int compare(StringView other) const { return view().compare(other); }
+
+    // Computed on first use and then cached in the header , the chars can never change.
+    // Two threads may both compute it the first time , they store the same value so that is harmless.
+    size_t hash() const
+    {
+        if (!rep)
+            return StringView().hash();
+        size_t h = rep->hash.load(std::memory_order_relaxed);
+        if (h == 0)
+        {
+            h = view().hash();
+            rep->hash.store(h, std::memory_order_relaxed);
+        }
+        return h;
+    }
+
+    // An owning , mutable copy
+    String to_string() const { return String(data(), size()); }
+
+    // --- OPERATORS ---
+    friend bool operator==(const SharedString &a, const SharedString &b)
+    {
+        return a.rep == b.rep || a.view() == b.view(); // Same buffer means equal without reading it
+    }
+    friend bool operator!=(const SharedString &a, const SharedString &b) { return !(a == b); }
+    friend bool operator<(const SharedString &a, const SharedString &b) { return a.view() < b.view(); }
+
+    bool operator==(StringView other) const { return view() == other; }
+    bool operator!=(StringView other) const { return view() != other; }
+
+    friend std::ostream &operator<<(std::ostream &os, const SharedString &s)
+    {
+        os.write(s.data(), s.size());
+        return os;
+    }
+};
+
+namespace std
+{
+    template <>
+    struct hash<SharedString>
+    {
+        size_t operator()(const SharedString &s) const { return s.hash(); }
+    };
+}
@@ -0,0 +1,94 @@
+#pragma once
+#include <cstddef>
+#include "StringView.hpp"
+
+// Lazy split : for (StringView field : split(line, ',')) { ... }
+// Nothing is computed up front and nothing is allocated : the iterator finds the next delimiter only when
+// you move to the next field , and every field is a StringView pointing into the original text.
+// (The old way , find + substr in a loop , builds a new String for every field.)
+// The text must stay alive while the fields are used.
+
+// Same rules as splitting in most languages : "a,,b" -> "a" , "" , "b" ; "a," -> "a" , "" ; "" -> ""
+class SplitRange
+{
+private:
+    StringView text;
+    StringView delim; // Used when the delimiter is longer than one char
+    char one;         // The delimiter when it is a single char (kept by value , a view of it could dangle)
+    size_t dlen;
+
+public:
+    SplitRange(StringView t, StringView d) : text(t), delim(d), one(d.empty() ? '\0' : d[0]), dlen(d.size()) {}
+    SplitRange(StringView t, char d) : text(t), one(d), dlen(1) {}
+
+    class Iterator
+    {
+    private:
+        StringView rest;  // Text after the current field's delimiter
+        StringView field; // Current field
+        StringView delim;
+        char one;
+        size_t dlen;
+        bool done; // Past the last field (the end iterator)
+        bool last; // Current field is the last one
+
+        void advance()
+        {
+            if (last)
+            {
+                done = true;
+                return;
+            }
+            size_t at = dlen == 1 ? rest.find(one) : rest.find(delim); // memchr for one char
+            if (at == StringView::npos)
+            {
+                field = rest;
+                last = true;
+            }
+            else
+            {
+                field = rest.substr(0, at);
+                rest.remove_prefix(at + dlen);
+            }
+        }
+
+    public:
+        Iterator() : one('\0'), dlen(0), done(true), last(true) {}
+        Iterator(StringView t, StringView d, char c, size_t n) : rest(t), delim(d), one(c), dlen(n), done(false), last(false)
+        {
+            if (dlen == 0)
+            {
+                field = rest; // Nothing to split on : the whole text is one field
+                last = true;
+            }
+            else
+                advance();
+        }
+
+        StringView operator*() const { return field; }
+        const StringView *operator->() const { return &field; }
+
+        Iterator &operator++()
+        {
+            advance();
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator old = *this;
+            advance();
+            return old;
+        }
+
+        // Only meant for comparing against end()
+        bool operator==(const Iterator &other) const { return done == other.done && (done || field.data() == other.field.data()); }
+        bool operator!=(const Iterator &other) const { return !(*this == other); }
+    };
+
+    Iterator begin() const { return Iterator(text, delim, one, dlen); }
+    Iterator end() const { return Iterator(); }
+};
+
+inline SplitRange split(StringView text, StringView delim) { return SplitRange(text, delim); }
+inline SplitRange split(StringView text, char delim) { return SplitRange(text, delim); }
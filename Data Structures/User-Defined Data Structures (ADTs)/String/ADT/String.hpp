@@ -1,6 +1,12 @@
 #pragma once
 #include <iostream>
 #include <stdexcept>
+#include <memory>
+#include <utility>
+#include <cstring>
+#include "StringView.hpp"
+#include "CharConv.hpp"
+#include "Split.hpp"
 
 // This Class Demonstrates the usage of String Class.
 // There is a built-in class in C++ called std::string.
@@ -15,294 +21,566 @@
 // The Object itself (its data members) is on stack but data being pointed may or may not be in heap.
 // If 15-22 chars then data in stack otherwise heap.
 
-// Here in our class , the data being stored will be in heap whether any kind of length.
+// Here in our class , we also do SSO but without growing the object : it stays 24 bytes (On 64 Bit System).
 // The Size / Bytes of our std::string or our class String has fixed object size.
-// On stack it has fixed *data , capacity and size variables.
-// The thing growing its characters is in heap which is not visible to us but we can see by .size() or .length() or .capacity() methods.
-class String
+// On stack it has fixed size variable and a union of 16 bytes which is either :
+// a) Heap mode  : char pointer * to the data + capacity (for long strings) , or
+// b) Local mode : 16 chars stored right inside the object (up to 15 chars + '\0') , no heap at all.
+// One bit stolen from the size tells which of the two is active.
+// So most short strings (names , keys , numbers) never call new , even the default constructor doesn't.
+// The thing growing its characters is in heap (once longer than 15) which is not visible to us but we can see by .size() or .length() or .capacity() methods.
+
+// Allocator : (See String.txt)
+// Like std::basic_string , the heap memory comes from a plug-in allocator (std::allocator<char> by default).
+// It is always used through std::allocator_traits , so any std::allocator-compatible type works,
+// e.g ArenaAllocator<char> from ../../Allocator/Arena.hpp for short-lived strings.
+// String is just BasicString with the default allocator (same as std::string = std::basic_string<char>).
+
+// Growth Policy :
+// When a mutator runs out of room the new capacity is Growth::next(capacity) , here capacity * Num / Den.
+// It is part of the type (like the allocator) , not a global setting : one piece of code tuning it can't
+// change how every other string in the program grows , and there is nothing shared between threads.
+// e.g BasicString<std::allocator<char>, GeometricGrowth<3, 2>> grows by 1.5 (less spare memory , more copies).
+// Any type with a static size_t next(size_t cap) that returns more than cap works as a policy.
+template <size_t Num = 2, size_t Den = 1>
+struct GeometricGrowth
+{
+    static_assert(Den > 0 && Num > Den, "Growth factor must be greater than 1");
+    static size_t next(size_t cap) { return cap * Num / Den; }
+};
+
+template <typename Alloc = std::allocator<char>, typename Growth = GeometricGrowth<>>
+class BasicString
 {
 private:
-    char *_data;
-    size_t _size;
-    size_t _capacity;
+    using traits = std::allocator_traits<Alloc>;
+
+    static const size_t LOCAL_CAP = 16; // Bytes of the inline buffer , including '\0'
+
+    struct HeapRep
+    {
+        char *ptr;
+        size_t cap; // Bytes allocated , including '\0'
+    };
+
+    union
+    {
+        HeapRep _heap;            // Active when _on_heap == 1
+        char _local[LOCAL_CAP];   // Active when _on_heap == 0
+    };
+    size_t _size : 63;
+    size_t _on_heap : 1;
+    [[no_unique_address]] Alloc _alloc; // Empty allocators (like std::allocator) take no space
+
+    // --- MEMORY HELPERS (through the allocator) ---
+    char *alloc_buf(size_t n)
+    {
+        return traits::allocate(_alloc, n);
+    }
+
+    // n must be the same capacity that was passed to alloc_buf()
+    void free_buf(char *p, size_t n)
+    {
+        if (p != nullptr)
+            traits::deallocate(_alloc, p, n);
+    }
+
+    // Gives back the heap buffer (if any) and goes back to the empty local mode
+    void release()
+    {
+        if (_on_heap)
+            free_buf(_heap.ptr, _heap.cap);
+        _on_heap = 0;
+        _size = 0;
+        _local[0] = '\0';
+    }
+
+    // Gets a buffer of cap bytes for a string that has nothing yet : local if it fits , otherwise heap
+    char *init_buf(size_t cap)
+    {
+        if (cap <= LOCAL_CAP)
+        {
+            _on_heap = 0;
+            return _local;
+        }
+        _heap.ptr = alloc_buf(cap);
+        _heap.cap = cap;
+        _on_heap = 1;
+        return _heap.ptr;
+    }
+
+    // Takes the buffer of other (heap pointer or local bytes) and leaves other empty
+    void steal(BasicString &other)
+    {
+        if (other._on_heap)
+            _heap = other._heap;
+        else
+            memcpy(_local, other._local, LOCAL_CAP);
+        _size = other._size;
+        _on_heap = other._on_heap;
+
+        other._on_heap = 0;
+        other._size = 0;
+        other._local[0] = '\0';
+    }
 
     // --- MANUAL INTERNAL HELPERS ---
+    // Both go through the SIMD kernels (See StringKernels.hpp)
     size_t get_len(const char *s) const
     {
-        if (!s)
-            return 0;
-        size_t len = 0;
-        while (s[len] != '\0')
-            len++;
-        return len;
+        return s ? StringKernels::length(s) : 0;
     }
 
     void copy_raw(char *dest, const char *src, size_t n)
     {
-        for (size_t i = 0; i < n; i++)
-            dest[i] = src[i];
+        StringKernels::copy(dest, src, n);
         dest[n] = '\0';
     }
 
+    // --- GROWTH POLICY ---
+    // Every mutator that needs more room comes here , so they all grow the same way.
+    // Asking for exactly the needed size (what append / insert used to do) makes N small appends copy
+    // the whole string N times = O(N^2). Growing by a factor makes the copies add up to O(N) (amortized O(1) each).
+    // The factor comes from the Growth policy (see GeometricGrowth above).
+    // Makes room for at least need bytes (including '\0')
+    void grow(size_t need)
+    {
+        if (need <= capacity())
+            return;
+        size_t next = Growth::next(capacity());
+        reserve(next > need ? next : need);
+    }
+
 public:
     static const size_t npos = -1;
 
-    // 1. Default Constructor
-    String() : _size(0), _capacity(16)
+    // 1. Default Constructor (No heap , empty local buffer)
+    BasicString() : _size(0), _on_heap(0), _alloc()
     {
-        _data = new char[_capacity];
-        _data[0] = '\0';
+        _local[0] = '\0';
+    }
+
+    // Empty string that takes its memory from a (e.g an arena)
+    explicit BasicString(const Alloc &a) : _size(0), _on_heap(0), _alloc(a)
+    {
+        _local[0] = '\0';
     }
 
     // 2. C-String Constructor (O(n))
-    String(const char *s)
+    BasicString(const char *s, const Alloc &a = Alloc()) : _alloc(a)
     {
-        _size = get_len(s);
-        _capacity = _size + 16;
-        _data = new char[_capacity];
-        copy_raw(_data, s, _size);
+        size_t n = get_len(s); // Local copy , the compiler can't track a value through the _size bit-field
+        _size = n;
+        char *d = init_buf(n < LOCAL_CAP ? n + 1 : n + 16); // Local if it fits , else heap with room to grow
+        copy_raw(d, s, n);
     }
 
     // 3. Buffer Constructor (O(n)) - Takes first 'n' chars from a char array
-    String(const char *s, size_t n) : _size(n), _capacity(n + 1)
+    BasicString(const char *s, size_t n, const Alloc &a = Alloc()) : _size(n), _alloc(a)
     {
-        _data = new char[_capacity];
-        for (size_t i = 0; i < n; i++)
-            _data[i] = s[i];
-        _data[_size] = '\0';
+        char *d = init_buf(n + 1);
+        copy_raw(d, s, n);
     }
 
     // 4. Fill Constructor (O(n)) - String s(10, 'A') -> "AAAAAAAAAA"
-    String(size_t n, char c) : _size(n), _capacity(n + 1)
+    BasicString(size_t n, char c, const Alloc &a = Alloc()) : _size(n), _alloc(a)
     {
-        _data = new char[_capacity];
+        char *d = init_buf(n + 1);
         for (size_t i = 0; i < n; i++)
-            _data[i] = c;
-        _data[_size] = '\0';
+            d[i] = c;
+        d[_size] = '\0';
     }
 
     // 5. Single Char Constructor
     // Here explicit keyword allows user not to pass any int , or a string as char can accept that
     // Its just for a single char input.
-    explicit String(char c) : _size(1), _capacity(16)
+    explicit BasicString(char c, const Alloc &a = Alloc()) : _size(1), _on_heap(0), _alloc(a)
     {
-        _data = new char[_capacity];
-        _data[0] = c;
-        _data[1] = '\0';
+        _local[0] = c;
+        _local[1] = '\0';
     }
 
-    // 6. Copy Constructor (Rule of 5 - Deep Copy)
-    String(const String &other) : _size(other._size), _capacity(other._size + 1)
+    // 5b. StringView Constructor (O(n)) - Makes an owning copy of the viewed chars
+    explicit BasicString(StringView sv, const Alloc &a = Alloc()) : BasicString(sv.data(), sv.size(), a) {}
+
+    // 6. Copy Constructor (Rule of 5 - Deep Copy , short strings stay local)
+    BasicString(const BasicString &other)
+        : _size(other._size), _alloc(traits::select_on_container_copy_construction(other._alloc))
     {
-        _data = new char[_capacity];
-        copy_raw(_data, other._data, _size);
+        char *d = init_buf(_size + 1);
+        copy_raw(d, other.data(), _size);
     }
 
     // 7. Move Constructor (Rule of 5 - Shallow Copy/Steal)
-    String(String &&other) noexcept
-        : _data(other._data), _size(other._size), _capacity(other._capacity)
+    // A local string has nothing on heap to steal , so its 16 bytes are just copied.
+    BasicString(BasicString &&other) noexcept : _alloc(std::move(other._alloc))
     {
-        other._data = nullptr;
-        other._size = 0;
-        other._capacity = 0;
+        steal(other);
     }
 
     // --- DESTRUCTOR ---
-    ~String() { delete[] _data; }
+    ~BasicString()
+    {
+        if (_on_heap)
+            free_buf(_heap.ptr, _heap.cap);
+    }
 
     // --- ASSIGNMENT OPERATORS ---
-    String &operator=(const String &other)
+    BasicString &operator=(const BasicString &other)
     {
         if (this != &other)
         {
-            char *new_buf = new char[other._size + 1];
-            copy_raw(new_buf, other._data, other._size);
-            delete[] _data;
-            _data = new_buf;
+            // Some allocators want the copy to use the source's allocator (e.g the same arena)
+            if constexpr (traits::propagate_on_container_copy_assignment::value)
+            {
+                if (_alloc != other._alloc)
+                {
+                    release(); // Old buffer must go back to the old allocator
+                    _alloc = other._alloc;
+                }
+            }
+
+            // Reuse our own buffer when it is big enough , no allocation at all
+            if (other._size + 1 > capacity())
+            {
+                char *new_buf = alloc_buf(other._size + 1);
+                if (_on_heap)
+                    free_buf(_heap.ptr, _heap.cap);
+                _heap.ptr = new_buf;
+                _heap.cap = other._size + 1;
+                _on_heap = 1;
+            }
+            copy_raw(data(), other.data(), other._size);
             _size = other._size;
-            _capacity = _size + 1;
         }
         return *this;
     }
 
-    String &operator=(String &&other) noexcept
+    BasicString &operator=(BasicString &&other) noexcept(traits::propagate_on_container_move_assignment::value ||
+                                                         traits::is_always_equal::value)
     {
         if (this != &other)
         {
-            delete[] _data;
-            _data = other._data;
-            _size = other._size;
-            _capacity = other._capacity;
-            other._data = nullptr;
-            other._size = 0;
-            other._capacity = 0;
+            // Our allocator can't free other's buffer , so we copy instead of stealing
+            if constexpr (!traits::propagate_on_container_move_assignment::value)
+            {
+                if (_alloc != other._alloc)
+                    return *this = static_cast<const BasicString &>(other);
+            }
+
+            release();
+            if constexpr (traits::propagate_on_container_move_assignment::value)
+                _alloc = std::move(other._alloc);
+            steal(other);
         }
         return *this;
     }
 
+    Alloc get_allocator() const { return _alloc; }
+
     // --- ELEMENT ACCESS (Bounds Checked) ---
-    char &operator[](size_t idx) { return _data[idx]; }
-    const char &operator[](size_t idx) const { return _data[idx]; }
+    char &operator[](size_t idx) { return data()[idx]; }
+    const char &operator[](size_t idx) const { return data()[idx]; }
 
     char &at(size_t idx)
     {
         if (idx >= _size)
             throw std::out_of_range("Index out of bounds");
-        return _data[idx];
+        return data()[idx];
     }
 
-    char &front() { return _data[0]; }
-    char &back() { return _data[_size - 1]; }
-    const char *c_str() const { return _data; }
+    char &front() { return data()[0]; }
+    char &back() { return data()[_size - 1]; }
+    const char *c_str() const { return data(); }
+
+    // Non-owning view of the whole string (O(1) , no allocation).
+    // Implicit , so every function taking a StringView also accepts a String.
+    operator StringView() const { return StringView(data(), _size); }
+
+    // Where the chars live right now : the heap buffer or the local one inside the object
+    char *data() { return _on_heap ? _heap.ptr : _local; }
+    const char *data() const { return _on_heap ? _heap.ptr : _local; }
+
+    // true when the chars are inside the object itself (Small String Optimization)
+    bool is_local() const { return !_on_heap; }
 
     // --- CAPACITY & MODIFIERS ---
     size_t length() const { return _size; }
     size_t size() const { return _size; }
-    size_t capacity() const { return _capacity; } // Check this to see the "real" growth! ,
-    // This capacity() function will tell you about the string's actual size being pointed by the _data pointer.
+    size_t capacity() const { return _on_heap ? _heap.cap : LOCAL_CAP; } // Check this to see the "real" growth! ,
+    // This capacity() function will tell you about the string's actual buffer size , local (16) or the one pointed on heap.
 
     bool empty() const { return _size == 0; }
 
     void reserve(size_t n)
     {
-        if (n <= _capacity)
+        if (n <= capacity())
             return;
-        char *temp = new char[n];
-        copy_raw(temp, _data, _size);
-        delete[] _data;
-        _data = temp;
-        _capacity = n;
+        char *temp = alloc_buf(n);
+        copy_raw(temp, data(), _size);
+        if (_on_heap)
+            free_buf(_heap.ptr, _heap.cap);
+        _heap.ptr = temp;
+        _heap.cap = n;
+        _on_heap = 1;
     }
 
     void push_back(char c)
     {
-        if (_size + 1 >= _capacity)
-            reserve(_capacity * 2);
-        _data[_size++] = c;
-        _data[_size] = '\0';
+        size_t n = _size; // Local copy , writes through char* could otherwise force re-reading _size
+        if (n + 1 >= capacity())
+            grow(n + 2);
+        char *d = data();
+        d[n] = c;
+        d[n + 1] = '\0';
+        _size = n + 1;
     }
 
-    void append(const String &str)
+    // Accepts String , StringView or "literal". Amortized O(len) thanks to the growth policy.
+    BasicString &append(StringView str)
     {
-        size_t n = _size + str._size;
-        if (n >= _capacity)
-            reserve(n + 1);
-        for (size_t i = 0; i < str._size; i++)
-            _data[_size + i] = str._data[i];
+        size_t len = str.size();
+        size_t n = _size + len;
+        const char *src = str.data();
+        if (n >= capacity())
+        {
+            // str may be a view into ourselves (s.append(s)) , remember where it was before the buffer moves
+            bool inside = src >= data() && src <= data() + _size;
+            size_t offset = inside ? src - data() : 0;
+            grow(n + 1);
+            if (inside)
+                src = data() + offset;
+        }
+        char *d = data();
+        memmove(d + _size, src, len);
         _size = n;
-        _data[_size] = '\0';
+        d[n] = '\0';
+        return *this;
     }
 
-    void insert(size_t pos, const char *s)
+    void insert(size_t pos, StringView str)
     {
         if (pos > _size)
             throw std::out_of_range("Insert error");
-        size_t slen = get_len(s);
-        if (_size + slen >= _capacity)
-            reserve(_size + slen + 1);
-        for (int i = (int)_size; i >= (int)pos; i--)
-            _data[i + slen] = _data[i];
-        for (size_t i = 0; i < slen; i++)
-            _data[pos + i] = s[i];
+        size_t slen = str.size();
+        const char *src = str.data();
+        bool inside = src >= data() && src <= data() + _size;
+        size_t offset = inside ? src - data() : 0;
+        if (_size + slen >= capacity())
+            grow(_size + slen + 1);
+
+        char *d = data();
+        memmove(d + pos + slen, d + pos, _size - pos + 1); // Tail moves right , '\0' included
+        if (inside)
+        {
+            // str was part of ourselves : the chars after pos have just moved slen to the right
+            src = d + offset;
+            if (offset >= pos)
+                src += slen;
+            else if (offset + slen > pos)
+            {
+                size_t before = pos - offset; // Piece of str left of the gap stays , the rest moved
+                memmove(d + pos, src, before);
+                memmove(d + pos + before, d + pos + slen, slen - before);
+                _size += slen;
+                return;
+            }
+        }
+        memmove(d + pos, src, slen);
         _size += slen;
     }
 
+    // Empties the string but keeps its buffer , so refilling it (e.g getline in a loop) doesn't allocate
+    void clear()
+    {
+        _size = 0;
+        data()[0] = '\0';
+    }
+
     void erase(size_t pos, size_t len)
     {
         if (pos >= _size)
             throw std::out_of_range("Erase error");
         if (pos + len > _size)
             len = _size - pos;
+        char *d = data();
         for (size_t i = pos; i <= _size - len; i++)
-            _data[i] = _data[i + len];
+            d[i] = d[i + len];
         _size -= len;
     }
 
     // --- SEARCH & SUBSTRING ---
-    String substr(size_t pos, size_t len = npos) const
+    BasicString substr(size_t pos, size_t len = npos) const
     {
         if (pos >= _size)
             throw std::out_of_range("Substr error");
         if (len == npos || pos + len > _size)
             len = _size - pos;
-        return String(_data + pos, len); // Uses Constructor #3
+        return BasicString(data() + pos, len, _alloc); // Uses Constructor #3
     }
 
-    size_t find(const char *s, size_t pos = 0) const
+    // Accepts String , StringView or "literal" (all of them become a StringView , no allocation)
+    size_t find(StringView s, size_t pos = 0) const
     {
-        size_t slen = get_len(s);
-        if (slen == 0)
-            return pos;
-        for (size_t i = pos; i <= (int)_size - (int)slen; i++)
-        {
-            size_t j = 0;
-            while (j < slen && _data[i + j] == s[j])
-                j++;
-            if (j == slen)
-                return i;
-        }
-        return npos;
+        return StringView(data(), _size).find(s, pos);
+    }
+
+    size_t find(char c, size_t pos = 0) const
+    {
+        return StringView(data(), _size).find(c, pos);
+    }
+
+    size_t rfind(StringView s, size_t pos = npos) const
+    {
+        return StringView(data(), _size).rfind(s, pos);
+    }
+
+    size_t find_first_of(StringView set, size_t pos = 0) const
+    {
+        return StringView(data(), _size).find_first_of(set, pos);
+    }
+
+    size_t find_last_of(StringView set, size_t pos = npos) const
+    {
+        return StringView(data(), _size).find_last_of(set, pos);
+    }
+
+    // Lazy split into StringViews pointing into this string (See Split.hpp) :
+    // for (StringView field : line.split(',')) ...
+    SplitRange split(char delim) const { return SplitRange(StringView(data(), _size), delim); }
+    SplitRange split(StringView delim) const { return SplitRange(StringView(data(), _size), delim); }
+
+    bool starts_with(StringView s) const { return StringView(data(), _size).starts_with(s); }
+    bool ends_with(StringView s) const { return StringView(data(), _size).ends_with(s); }
+
+    // Lexicographic : < 0 if this comes first , 0 if equal , > 0 if other comes first
+    int compare(StringView other) const { return StringView(data(), _size).compare(other); }
+
+    // Same value as StringView::hash() of the same chars , so a String and a view of it land in the same bucket.
+    // Not cached : a String can change at any time (SharedString , which can't , caches it).
+    size_t hash() const { return StringView(data(), _size).hash(); }
+
+    // --- CONVERSIONS (No allocation , no exceptions , See CharConv.hpp) ---
+    // Write a number into [first , last) , works for every integer type and double.
+    // char buf[32]; auto r = String::to_chars(buf, buf + 32, 12345); -> chars are [buf , r.ptr)
+    template <typename T>
+    static std::to_chars_result to_chars(char *first, char *last, T value)
+    {
+        return CharConv::to_chars(first, last, value);
+    }
+
+    // Read a number from the start of [first , last) , r.ptr is where the number ended
+    template <typename T>
+    static std::from_chars_result from_chars(const char *first, const char *last, T &value)
+    {
+        return CharConv::from_chars(first, last, value);
+    }
+
+    template <typename T>
+    static std::from_chars_result from_chars(StringView s, T &value)
+    {
+        return CharConv::from_chars(s.data(), s.data() + s.size(), value);
+    }
+
+    // Formats value straight onto the end of this string (e.g building a metrics line)
+    template <typename T>
+    BasicString &append_number(T value)
+    {
+        char buf[32]; // Enough for any 64 bit integer or shortest double
+        std::to_chars_result r = CharConv::to_chars(buf, buf + sizeof(buf), value);
+        return append(StringView(buf, r.ptr - buf));
     }
 
     // --- CONVERSIONS (STRICT VALIDATION) ---
-    static int stoi(const String &s)
+    static int stoi(const BasicString &s)
     {
         if (s.empty())
             throw std::invalid_argument("stoi: empty");
-        long long res = 0;
-        int sign = 1, i = 0;
-        if (s[0] == '-')
-        {
-            sign = -1;
-            i = 1;
-        }
-        for (; i < s._size; i++)
-        {
-            if (s[i] < '0' || s[i] > '9')
-                throw std::invalid_argument("stoi: invalid char");
-            res = res * 10 + (s[i] - '0');
-        }
-        return (int)(res * sign);
+        int res = 0;
+        std::from_chars_result r = CharConv::from_chars(s.data(), s.data() + s._size, res);
+        if (r.ec == std::errc::result_out_of_range)
+            throw std::out_of_range("stoi: out of range");
+        if (r.ec != std::errc() || r.ptr != s.data() + s._size)
+            throw std::invalid_argument("stoi: invalid char");
+        return res;
     }
 
-    static String to_string(int val)
+    // Any integer type or double (double gives the shortest text that reads back the same , e.g "0.1")
+    template <typename T>
+    static BasicString to_string(T val)
     {
-        if (val == 0)
-            return String("0");
-        char buf[12];
-        int i = 0;
-        long long n = (val < 0) ? -(long long)val : val;
-        while (n > 0)
-        {
-            buf[i++] = (n % 10) + '0';
-            n /= 10;
-        }
-        if (val < 0)
-            buf[i++] = '-';
-        buf[i] = '\0';
-        for (int j = 0; j < i / 2; j++)
-        {
-            char t = buf[j];
-            buf[j] = buf[i - j - 1];
-            buf[i - j - 1] = t;
-        }
-        return String(buf);
+        char buf[32];
+        std::to_chars_result r = CharConv::to_chars(buf, buf + sizeof(buf), val);
+        return BasicString(buf, r.ptr - buf);
     }
 
     // --- OPERATORS ---
-    bool operator==(const String &other) const
+    // Takes a StringView so s == "abc" doesn't build a temporary String first
+    bool operator==(StringView other) const
+    {
+        return _size == other.size() && StringKernels::equal(data(), other.data(), _size);
+    }
+
+    bool operator!=(StringView other) const { return !(*this == other); }
+
+    // Ordering (lexicographic , like std::string) , so String works with std::sort and as a std::map key
+    friend bool operator<(const BasicString &a, const BasicString &b) { return a.compare(b) < 0; }
+    friend bool operator>(const BasicString &a, const BasicString &b) { return a.compare(b) > 0; }
+    friend bool operator<=(const BasicString &a, const BasicString &b) { return a.compare(b) <= 0; }
+    friend bool operator>=(const BasicString &a, const BasicString &b) { return a.compare(b) >= 0; }
+
+    // --- CONCATENATION ---
+    BasicString &operator+=(StringView str) { return append(str); }
+
+    BasicString &operator+=(char c)
+    {
+        push_back(c);
+        return *this;
+    }
+
+    // a + b makes one buffer of the final size , never a second copy
+    friend BasicString operator+(const BasicString &a, StringView b)
+    {
+        BasicString result(traits::select_on_container_copy_construction(a._alloc));
+        result.reserve(a._size + b.size() + 1);
+        result.append(a);
+        result.append(b);
+        return result;
+    }
+
+    // Left side is a temporary (e.g a + b + c) : append into its buffer and hand it on , no new allocation
+    // as long as it has room. This is what keeps a long chain of + linear.
+    friend BasicString operator+(BasicString &&a, StringView b)
+    {
+        a.append(b);
+        return std::move(a);
+    }
+
+    // "literal" + s (the overloads above need a String on the left)
+    friend BasicString operator+(const char *a, const BasicString &b)
+    {
+        StringView left(a);
+        BasicString result(traits::select_on_container_copy_construction(b._alloc));
+        result.reserve(left.size() + b._size + 1);
+        result.append(left);
+        result.append(b);
+        return result;
+    }
+
+    friend BasicString operator+(const BasicString &a, char c)
     {
-        if (_size != other._size)
-            return false;
-        for (size_t i = 0; i < _size; i++)
-            if (_data[i] != other._data[i])
-                return false;
-        return true;
+        return a + StringView(&c, 1);
     }
 
-    friend std::ostream &operator<<(std::ostream &os, const String &s)
+    friend BasicString operator+(BasicString &&a, char c)
     {
-        os << s._data;
+        a.push_back(c);
+        return std::move(a);
+    }
+
+    friend std::ostream &operator<<(std::ostream &os, const BasicString &s)
+    {
+        os << s.data();
         return os;
     }
 
@@ -360,13 +638,26 @@ public:
 
     Iterator begin()
     {
-        // Passes the start (_data) and the limit (_data + _size) to the iterator
-        return Iterator(_data, _data, _data + _size);
+        // Passes the start (data()) and the limit (data() + _size) to the iterator
+        return Iterator(data(), data(), data() + _size);
     }
 
     Iterator end()
     {
         // Still points to the end, but knows the boundaries
-        return Iterator(_data + _size, _data, _data + _size);
+        return Iterator(data() + _size, data(), data() + _size);
     }
-};
\ No newline at end of file
+};
+
+// The everyday String , exactly like before (heap memory through new / delete)
+using String = BasicString<>;
+
+// Allows std::unordered_map<String, T> and std::unordered_set<String> (any allocator and growth policy)
+namespace std
+{
+    template <typename Alloc, typename Growth>
+    struct hash<BasicString<Alloc, Growth>>
+    {
+        size_t operator()(const BasicString<Alloc, Growth> &s) const { return s.hash(); }
+    };
+}
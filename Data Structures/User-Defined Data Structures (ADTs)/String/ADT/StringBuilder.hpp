@@ -0,0 +1,171 @@
+#pragma once
+#include <iostream>
+#include <new>
+#include <stdexcept>
+#include <cstring>
+#include "String.hpp"
+
+// StringBuilder : for building one big String out of many small pieces (e.g a response body).
+// Appending to a String moves the whole text every time the buffer grows.
+// Here the text is kept as a linked list of chunks instead , and a full chunk is never touched again :
+// a new (bigger) one is just linked after it. So every byte is copied exactly twice :
+// once into a chunk by append() , and once into the final String by str() (a single allocation of the exact size).
+// Usage :
+// StringBuilder sb;
+// sb << "HTTP/1.1 " << status << '\n';
+// String body = sb.str();
+class StringBuilder
+{
+private:
+    // Header placed in front of the chars of every chunk (one allocation per chunk)
+    struct Chunk
+    {
+        Chunk *next;
+        size_t used;
+        size_t cap;
+
+        char *chars() { return reinterpret_cast<char *>(this + 1); }
+    };
+
+    static const size_t FIRST_CHUNK = 256;
+    static const size_t MAX_CHUNK = 1024 * 1024; // Chunks stop doubling here , no point in huge blocks
+
+    Chunk *head;
+    Chunk *tail;
+    size_t _size;
+    size_t next_cap;
+
+    void add_chunk(size_t min_cap)
+    {
+        size_t cap = next_cap > min_cap ? next_cap : min_cap;
+        void *mem = nullptr;
+        try
+        {
+            mem = ::operator new(sizeof(Chunk) + cap);
+        }
+        catch (const std::bad_alloc &)
+        {
+            throw std::runtime_error("StringBuilder: Allocation failed.");
+        }
+
+        Chunk *c = static_cast<Chunk *>(mem);
+        c->next = nullptr;
+        c->used = 0;
+        c->cap = cap;
+        if (tail)
+            tail->next = c;
+        else
+            head = c;
+        tail = c;
+        if (next_cap < MAX_CHUNK)
+            next_cap *= 2;
+    }
+
+    void free_chunks()
+    {
+        while (head)
+        {
+            Chunk *next = head->next;
+            ::operator delete(head);
+            head = next;
+        }
+        tail = nullptr;
+    }
+
+public:
+    explicit StringBuilder(size_t first_chunk = FIRST_CHUNK)
+        : head(nullptr), tail(nullptr), _size(0), next_cap(first_chunk > 0 ? first_chunk : FIRST_CHUNK) {}
+
+    // Owns its chunks , copying a half built text is almost always a mistake
+    StringBuilder(const StringBuilder &) = delete;
+    StringBuilder &operator=(const StringBuilder &) = delete;
+
+    StringBuilder(StringBuilder &&other) noexcept
+        : head(other.head), tail(other.tail), _size(other._size), next_cap(other.next_cap)
+    {
+        other.head = other.tail = nullptr;
+        other._size = 0;
+    }
+
+    StringBuilder &operator=(StringBuilder &&other) noexcept
+    {
+        if (this != &other)
+        {
+            free_chunks();
+            head = other.head;
+            tail = other.tail;
+            _size = other._size;
+            next_cap = other.next_cap;
+            other.head = other.tail = nullptr;
+            other._size = 0;
+        }
+        return *this;
+    }
+
+    ~StringBuilder()
+    {
+        free_chunks();
+    }
+
+    size_t size() const { return _size; }
+    size_t length() const { return _size; }
+    bool empty() const { return _size == 0; }
+
+    // Accepts String , StringView or "literal"
+    StringBuilder &append(StringView s)
+    {
+        const char *src = s.data();
+        size_t left = s.size();
+        while (left > 0)
+        {
+            if (!tail || tail->used == tail->cap)
+                add_chunk(left);
+            size_t n = tail->cap - tail->used;
+            if (n > left)
+                n = left;
+            memcpy(tail->chars() + tail->used, src, n);
+            tail->used += n;
+            src += n;
+            left -= n;
+        }
+        _size += s.size();
+        return *this;
+    }
+
+    StringBuilder &append(char c)
+    {
+        if (!tail || tail->used == tail->cap)
+            add_chunk(1);
+        tail->chars()[tail->used++] = c;
+        _size++;
+        return *this;
+    }
+
+    StringBuilder &operator<<(StringView s) { return append(s); }
+    StringBuilder &operator<<(char c) { return append(c); }
+
+    // Single materialization : one String of the exact final size , chunks copied in order
+    String str() const
+    {
+        String result;
+        result.reserve(_size + 1);
+        for (Chunk *c = head; c; c = c->next)
+            result.append(StringView(c->chars(), c->used));
+        return result;
+    }
+
+    // Drops the text but keeps growing from the last chunk size , handy when reused in a loop
+    void clear()
+    {
+        free_chunks();
+        _size = 0;
+    }
+
+    // Writes the chunks one after the other , no String is built
+    friend std::ostream &operator<<(std::ostream &os, const StringBuilder &sb)
+    {
+        for (Chunk *c = sb.head; c; c = c->next)
+            os.write(c->chars(), c->used);
+        return os;
+    }
+};
@@ -0,0 +1,123 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Fast non-cryptographic hash for String , StringView , SharedString and StringPool.
+// The algorithm is wyhash (final version 4 , by Wang Yi , public domain) :
+// - reads the input 8 bytes at a time , 48 bytes per loop step in three independent lanes
+//   (so the CPU can work on the lanes in parallel) ,
+// - mixes with one 64 x 64 -> 128 bit multiply per 16 bytes ("mum" : multiply , then xor the two halves),
+// - inputs up to 16 bytes (most keys) take no loop at all , just two overlapping loads.
+// The old FNV-1a did one multiply per BYTE , which is ~10x slower on long keys , and its low bits
+// (the ones a hash table uses for the bucket) are weak for similar keys like "key_1" , "key_2".
+// Not for security : someone who knows the seed can craft collisions on purpose.
+class StringHash
+{
+public:
+    static uint64_t hash(const char *data, size_t len, uint64_t seed = 0)
+    {
+        const uint8_t *p = (const uint8_t *)data;
+        uint64_t a, b;
+        seed ^= mix(seed ^ SECRET[0], SECRET[1]);
+
+        if (len <= 16)
+        {
+            if (len >= 4)
+            {
+                // Four 4 byte loads that together cover every byte (they overlap when len < 16)
+                a = (read4(p) << 32) | read4(p + ((len >> 3) << 2));
+                b = (read4(p + len - 4) << 32) | read4(p + len - 4 - ((len >> 3) << 2));
+            }
+            else if (len > 0)
+            {
+                a = read3(p, len);
+                b = 0;
+            }
+            else
+                a = b = 0;
+        }
+        else
+        {
+            size_t i = len;
+            if (i > 48)
+            {
+                uint64_t see1 = seed, see2 = seed;
+                do
+                {
+                    seed = mix(read8(p) ^ SECRET[1], read8(p + 8) ^ seed);
+                    see1 = mix(read8(p + 16) ^ SECRET[2], read8(p + 24) ^ see1);
+                    see2 = mix(read8(p + 32) ^ SECRET[3], read8(p + 40) ^ see2);
+                    p += 48;
+                    i -= 48;
+                } while (i > 48);
+                seed ^= see1 ^ see2;
+            }
+            while (i > 16)
+            {
+                seed = mix(read8(p) ^ SECRET[1], read8(p + 8) ^ seed);
+                i -= 16;
+                p += 16;
+            }
+            // Last 16 bytes , may overlap bytes already mixed in
+            a = read8(p + i - 16);
+            b = read8(p + i - 8);
+        }
+
+        a ^= SECRET[1];
+        b ^= seed;
+        mum(a, b);
+        return mix(a ^ SECRET[0] ^ len, b ^ SECRET[1]);
+    }
+
+private:
+    static constexpr uint64_t SECRET[4] = {0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL,
+                                           0x4b33a62ed433d4a3ULL, 0x4d5a2da51de1aa47ULL};
+
+    // 128 bit product of a and b : low half into a , high half into b
+    static void mum(uint64_t &a, uint64_t &b)
+    {
+#if defined(__SIZEOF_INT128__)
+        __uint128_t r = (__uint128_t)a * b;
+        a = (uint64_t)r;
+        b = (uint64_t)(r >> 64);
+#else
+        // Portable version : 4 32 bit products
+        uint64_t ha = a >> 32, hb = b >> 32, la = (uint32_t)a, lb = (uint32_t)b;
+        uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+        uint64_t t = rl + (rm0 << 32), c = t < rl;
+        uint64_t lo = t + (rm1 << 32);
+        c += lo < t;
+        uint64_t hi = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+        a = lo;
+        b = hi;
+#endif
+    }
+
+    static uint64_t mix(uint64_t a, uint64_t b)
+    {
+        mum(a, b);
+        return a ^ b;
+    }
+
+    // Little endian loads (same result on every machine this runs on in practice : x86 , ARM)
+    static uint64_t read8(const uint8_t *p)
+    {
+        uint64_t v;
+        memcpy(&v, p, 8);
+        return v;
+    }
+
+    static uint64_t read4(const uint8_t *p)
+    {
+        uint32_t v;
+        memcpy(&v, p, 4);
+        return v;
+    }
+
+    // 1 to 3 bytes : first , middle and last (they repeat when len < 3)
+    static uint64_t read3(const uint8_t *p, size_t len)
+    {
+        return ((uint64_t)p[0] << 16) | ((uint64_t)p[len >> 1] << 8) | p[len - 1];
+    }
+};
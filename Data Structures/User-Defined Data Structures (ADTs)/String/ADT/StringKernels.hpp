@@ -0,0 +1,298 @@
+#pragma once
+#include <cstddef>
+#include <cstring>
+#include <cstdint>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#define STRING_KERNELS_AVX2 1
+#endif
+
+// Low level byte kernels that String , StringView and StringSearch are built on :
+// length ('\0' search) , copy , equality and three-way compare.
+// Plain byte loops (for i ... if a[i] != b[i]) are hard for compilers to vectorize because of the early exit,
+// so these work 16 bytes at a time with SSE2 (every x86-64 CPU has it) , or 32 with AVX2 when the CPU has it.
+// AVX2 is picked at runtime , so the same binary still runs on older CPUs.
+// Short inputs (most strings are short) skip SIMD and use a couple of overlapping 8 byte loads instead.
+// Without SSE2 (other CPUs) everything falls back to the C library or plain loops.
+class StringKernels
+{
+public:
+    // Asked once , then cached
+    static bool has_avx2()
+    {
+#if defined(STRING_KERNELS_AVX2)
+        static const bool yes = __builtin_cpu_supports("avx2");
+        return yes;
+#else
+        return false;
+#endif
+    }
+
+    // --- LENGTH (like strlen) ---
+    static size_t length(const char *s)
+    {
+#if defined(__GNUC__)
+        if (__builtin_constant_p(strlen(s)))
+            return strlen(s); // A "literal" : the compiler already knows the answer , no code at all
+#endif
+#if defined(STRING_KERNELS_AVX2)
+        if (has_avx2())
+            return length_avx2(s);
+#endif
+#if defined(__SSE2__)
+        return length_sse2(s);
+#else
+        return strlen(s);
+#endif
+    }
+
+    // --- COPY (like memcpy , dest and src must not overlap) ---
+    static void copy(char *dest, const char *src, size_t n)
+    {
+        if (n < 16)
+        {
+            copy_small(dest, src, n);
+            return;
+        }
+#if defined(__SSE2__)
+        // Big copies : the C library memcpy already uses the widest vectors the CPU has
+        if (n <= 256)
+        {
+            // The last block overlaps the previous one instead of a byte by byte tail
+            size_t i = 0;
+            for (; i + 16 < n; i += 16)
+                _mm_storeu_si128((__m128i *)(dest + i), _mm_loadu_si128((const __m128i *)(src + i)));
+            _mm_storeu_si128((__m128i *)(dest + n - 16), _mm_loadu_si128((const __m128i *)(src + n - 16)));
+            return;
+        }
+#endif
+        memcpy(dest, src, n);
+    }
+
+    // --- EQUALITY of a[0..n) and b[0..n) ---
+    static bool equal(const char *a, const char *b, size_t n)
+    {
+        if (n < 16)
+            return equal_small(a, b, n);
+#if defined(STRING_KERNELS_AVX2)
+        if (n >= 64 && has_avx2())
+            return equal_avx2(a, b, n);
+#endif
+#if defined(__SSE2__)
+        return equal_sse2(a, b, n);
+#else
+        return memcmp(a, b, n) == 0;
+#endif
+    }
+
+    // --- THREE-WAY COMPARE (like memcmp) : < 0 , 0 or > 0 , chars compared as unsigned ---
+    static int compare(const char *a, const char *b, size_t n)
+    {
+        if (n < 16)
+            return compare_small(a, b, n);
+#if defined(STRING_KERNELS_AVX2)
+        if (n >= 64 && has_avx2())
+            return compare_avx2(a, b, n);
+#endif
+#if defined(__SSE2__)
+        return compare_sse2(a, b, n);
+#else
+        return memcmp(a, b, n);
+#endif
+    }
+
+private:
+    // Unaligned loads through memcpy , the compiler turns them into single mov instructions
+    static uint64_t load64(const char *p)
+    {
+        uint64_t v;
+        memcpy(&v, p, 8);
+        return v;
+    }
+
+    static uint32_t load32(const char *p)
+    {
+        uint32_t v;
+        memcpy(&v, p, 4);
+        return v;
+    }
+
+    // Bytes in memory order as one number , so comparing numbers compares the bytes lexicographically
+    static uint64_t load64_be(const char *p)
+    {
+        uint64_t v = load64(p);
+#if defined(__GNUC__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        v = __builtin_bswap64(v);
+#endif
+        return v;
+    }
+
+    // n < 16 : two overlapping loads cover everything (e.g n = 11 is bytes [0 , 8) and [3 , 11))
+    static void copy_small(char *dest, const char *src, size_t n)
+    {
+        if (n >= 8)
+        {
+            uint64_t head = load64(src), tail = load64(src + n - 8);
+            memcpy(dest, &head, 8);
+            memcpy(dest + n - 8, &tail, 8);
+        }
+        else if (n >= 4)
+        {
+            uint32_t head = load32(src), tail = load32(src + n - 4);
+            memcpy(dest, &head, 4);
+            memcpy(dest + n - 4, &tail, 4);
+        }
+        else
+        {
+            for (size_t i = 0; i < n; i++)
+                dest[i] = src[i];
+        }
+    }
+
+    static bool equal_small(const char *a, const char *b, size_t n)
+    {
+        if (n >= 8)
+            return ((load64(a) ^ load64(b)) | (load64(a + n - 8) ^ load64(b + n - 8))) == 0;
+        if (n >= 4)
+            return ((load32(a) ^ load32(b)) | (load32(a + n - 4) ^ load32(b + n - 4))) == 0;
+        for (size_t i = 0; i < n; i++)
+            if (a[i] != b[i])
+                return false;
+        return true;
+    }
+
+    static int compare_small(const char *a, const char *b, size_t n)
+    {
+        if (n >= 8)
+        {
+            // Overlapping bytes are equal in both halves (or the first half already decided) , so this is exact
+            uint64_t x = load64_be(a), y = load64_be(b);
+            if (x == y)
+            {
+                x = load64_be(a + n - 8);
+                y = load64_be(b + n - 8);
+            }
+            return x == y ? 0 : (x < y ? -1 : 1);
+        }
+        for (size_t i = 0; i < n; i++)
+        {
+            if (a[i] != b[i])
+                return (unsigned char)a[i] < (unsigned char)b[i] ? -1 : 1;
+        }
+        return 0;
+    }
+
+    static int byte_diff(const char *a, const char *b, size_t i)
+    {
+        return (unsigned char)a[i] < (unsigned char)b[i] ? -1 : 1;
+    }
+
+#if defined(__SSE2__)
+    // The string is read in aligned 16 byte blocks. An aligned block never crosses a page , so reading a few
+    // bytes past the '\0' can't fault (same trick as the C library strlen). AddressSanitizer doesn't know that.
+    __attribute__((no_sanitize_address)) static size_t length_sse2(const char *s)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        const char *p = (const char *)((uintptr_t)s & ~(uintptr_t)15);
+        unsigned mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128((const __m128i *)p), zero));
+        mask >>= (s - p); // Ignore the bytes before s
+        if (mask)
+            return __builtin_ctz(mask);
+        while (true)
+        {
+            p += 16;
+            mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128((const __m128i *)p), zero));
+            if (mask)
+                return p + __builtin_ctz(mask) - s;
+        }
+    }
+
+    // n >= 16 , the last block overlaps the previous one instead of a scalar tail loop
+    static bool equal_sse2(const char *a, const char *b, size_t n)
+    {
+        for (size_t i = 0; i + 16 < n; i += 16)
+        {
+            __m128i x = _mm_loadu_si128((const __m128i *)(a + i));
+            __m128i y = _mm_loadu_si128((const __m128i *)(b + i));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(x, y)) != 0xFFFF)
+                return false;
+        }
+        __m128i x = _mm_loadu_si128((const __m128i *)(a + n - 16));
+        __m128i y = _mm_loadu_si128((const __m128i *)(b + n - 16));
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(x, y)) == 0xFFFF;
+    }
+
+    static int compare_sse2(const char *a, const char *b, size_t n)
+    {
+        size_t i = 0;
+        while (true)
+        {
+            if (i + 16 > n)
+                i = n - 16; // Last block overlaps , the overlapped bytes are already known to be equal
+            __m128i x = _mm_loadu_si128((const __m128i *)(a + i));
+            __m128i y = _mm_loadu_si128((const __m128i *)(b + i));
+            unsigned diff = _mm_movemask_epi8(_mm_cmpeq_epi8(x, y)) ^ 0xFFFF;
+            if (diff)
+                return byte_diff(a, b, i + __builtin_ctz(diff));
+            i += 16;
+            if (i >= n)
+                return 0;
+        }
+    }
+#endif
+
+#if defined(STRING_KERNELS_AVX2)
+    __attribute__((target("avx2"), no_sanitize_address)) static size_t length_avx2(const char *s)
+    {
+        const __m256i zero = _mm256_setzero_si256();
+        const char *p = (const char *)((uintptr_t)s & ~(uintptr_t)31);
+        unsigned mask = (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256((const __m256i *)p), zero));
+        mask >>= (s - p);
+        if (mask)
+            return __builtin_ctz(mask);
+        while (true)
+        {
+            p += 32;
+            mask = (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256((const __m256i *)p), zero));
+            if (mask)
+                return p + __builtin_ctz(mask) - s;
+        }
+    }
+
+    __attribute__((target("avx2"))) static bool equal_avx2(const char *a, const char *b, size_t n)
+    {
+        for (size_t i = 0; i + 32 < n; i += 32)
+        {
+            __m256i x = _mm256_loadu_si256((const __m256i *)(a + i));
+            __m256i y = _mm256_loadu_si256((const __m256i *)(b + i));
+            if ((unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)) != 0xFFFFFFFFu)
+                return false;
+        }
+        __m256i x = _mm256_loadu_si256((const __m256i *)(a + n - 32));
+        __m256i y = _mm256_loadu_si256((const __m256i *)(b + n - 32));
+        return (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)) == 0xFFFFFFFFu;
+    }
+
+    __attribute__((target("avx2"))) static int compare_avx2(const char *a, const char *b, size_t n)
+    {
+        size_t i = 0;
+        while (true)
+        {
+            if (i + 32 > n)
+                i = n - 32;
+            __m256i x = _mm256_loadu_si256((const __m256i *)(a + i));
+            __m256i y = _mm256_loadu_si256((const __m256i *)(b + i));
+            unsigned diff = (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)) ^ 0xFFFFFFFFu;
+            if (diff)
+                return byte_diff(a, b, i + __builtin_ctz(diff));
+            i += 32;
+            if (i >= n)
+                return 0;
+        }
+    }
+#endif
+};
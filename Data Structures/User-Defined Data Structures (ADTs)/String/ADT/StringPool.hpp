@@ -0,0 +1,252 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include "String.hpp"
+#include "../../Allocator/Arena.hpp"
+
+// StringPool (String Interning) : every distinct text is stored ONCE , and users keep a 4 byte handle to it.
+// Millions of repeated tokens ("GET" , "user_id" , country codes ...) as Strings cost 24 bytes each plus a heap
+// buffer for the long ones. As handles they cost 4 bytes , and the text of each distinct token is stored once.
+// Because the pool never stores the same text twice , two handles are equal exactly when their texts are equal:
+// comparing or hashing a handle is comparing or hashing one uint32_t , O(1) whatever the length.
+
+// Storage : the chars go into an Arena (../../Allocator/Arena.hpp) , bump allocated and never moved,
+// so a StringView / c_str() of an interned string stays valid for the whole life of the pool.
+// Nothing is ever removed (that is what makes the handles stable).
+
+// Thread safety : the pool is split into 16 shards by the hash of the text , each with its own lock
+// (std::shared_mutex : many readers or one writer). Threads interning different strings rarely wait for each other,
+// and lookups of strings that are already there only take the shared (read) lock.
+class StringHandle
+{
+    uint32_t _id;
+
+    friend class StringPool;
+    explicit StringHandle(uint32_t id) : _id(id) {}
+
+public:
+    StringHandle() : _id(INVALID) {} // Refers to nothing , what lookup() returns for a missing string
+
+    static const uint32_t INVALID = 0xFFFFFFFFu;
+
+    uint32_t id() const { return _id; }
+    bool valid() const { return _id != INVALID; }
+
+    friend bool operator==(StringHandle a, StringHandle b) { return a._id == b._id; }
+    friend bool operator!=(StringHandle a, StringHandle b) { return a._id != b._id; }
+    friend bool operator<(StringHandle a, StringHandle b) { return a._id < b._id; } // Order of ids , not of texts
+};
+
+namespace std
+{
+    template <>
+    struct hash<StringHandle>
+    {
+        size_t operator()(StringHandle h) const { return h.id() * 0x9E3779B97F4A7C15ULL; } // Spread the bits of small ids
+    };
+}
+
+class StringPool
+{
+private:
+    static const unsigned SHARD_BITS = 4;
+    static const unsigned SHARDS = 1u << SHARD_BITS;
+    static const uint32_t MAX_PER_SHARD = (StringHandle::INVALID >> SHARD_BITS) - 1;
+
+    struct Entry
+    {
+        const char *ptr; // Into the shard's arena , '\0' terminated
+        uint32_t len;
+        uint32_t hash;   // Low 32 bits of the full hash , compared before the chars
+    };
+
+    // An open addressing hash table of entry indexes (0 = empty slot , otherwise index + 1) + the entries
+    struct Shard
+    {
+        mutable std::shared_mutex lock;
+        Arena chars{16 * 1024};
+        Entry *entries = nullptr;
+        uint32_t count = 0;
+        uint32_t entries_cap = 0;
+        uint32_t *slots = nullptr;
+        size_t mask = 0; // Slots - 1 , slots is a power of 2
+
+        ~Shard()
+        {
+            delete[] entries;
+            delete[] slots;
+        }
+    };
+
+    Shard shards[SHARDS];
+
+    static uint64_t hash_of(StringView s) { return s.hash(); }
+
+    // Top bits pick the shard , low bits pick the slot inside it , so the two don't correlate
+    static unsigned shard_of(uint64_t h) { return (unsigned)(h >> (64 - SHARD_BITS)); }
+
+    // Index of s in shard , or -1. Caller holds the shard lock (shared or unique).
+    static int64_t find_in(const Shard &sh, StringView s, uint64_t h)
+    {
+        if (sh.slots == nullptr)
+            return -1;
+        for (size_t i = h & sh.mask;; i = (i + 1) & sh.mask) // Linear probing
+        {
+            uint32_t slot = sh.slots[i];
+            if (slot == 0)
+                return -1;
+            const Entry &e = sh.entries[slot - 1];
+            if (e.hash == (uint32_t)h && e.len == s.size() && StringKernels::equal(e.ptr, s.data(), e.len))
+                return slot - 1;
+        }
+    }
+
+    // Doubles the slot table , keeping it at most half full so probes stay short.
+    // Entries are re-slotted by their stored hash , no string is hashed again. Its low 32 bits are enough :
+    // a shard holds under 2^28 entries , so the table never has more than 2^30 slots.
+    static void grow_slots(Shard &sh)
+    {
+        size_t cap = sh.slots ? (sh.mask + 1) * 2 : 64;
+        uint32_t *slots = new uint32_t[cap]();
+        for (uint32_t idx = 0; idx < sh.count; idx++)
+        {
+            size_t i = sh.entries[idx].hash & (cap - 1);
+            while (slots[i] != 0)
+                i = (i + 1) & (cap - 1);
+            slots[i] = idx + 1;
+        }
+        delete[] sh.slots;
+        sh.slots = slots;
+        sh.mask = cap - 1;
+    }
+
+    static void grow_entries(Shard &sh)
+    {
+        uint32_t cap = sh.entries_cap ? sh.entries_cap * 2 : 64;
+        Entry *entries = new Entry[cap];
+        if (sh.count)
+            memcpy(entries, sh.entries, sh.count * sizeof(Entry));
+        delete[] sh.entries;
+        sh.entries = entries;
+        sh.entries_cap = cap;
+    }
+
+    // Caller holds the unique lock and knows s is not there yet
+    static uint32_t insert_in(Shard &sh, StringView s, uint64_t h)
+    {
+        if (sh.count >= MAX_PER_SHARD)
+            throw std::length_error("StringPool: Too many strings.");
+        if ((sh.count + 1) * 2 > sh.mask + 1 || sh.slots == nullptr)
+            grow_slots(sh);
+        if (sh.count == sh.entries_cap)
+            grow_entries(sh);
+
+        char *text = static_cast<char *>(sh.chars.allocate(s.size() + 1, 1));
+        memcpy(text, s.data(), s.size());
+        text[s.size()] = '\0';
+
+        uint32_t idx = sh.count++;
+        sh.entries[idx] = Entry{text, (uint32_t)s.size(), (uint32_t)h};
+
+        size_t i = h & sh.mask;
+        while (sh.slots[i] != 0)
+            i = (i + 1) & sh.mask;
+        sh.slots[i] = idx + 1;
+        return idx;
+    }
+
+    static StringHandle make_handle(unsigned shard, uint32_t idx)
+    {
+        return StringHandle((idx << SHARD_BITS) | shard);
+    }
+
+public:
+    StringPool() = default;
+
+    // Handles point into this pool's memory , a copy would silently mix up two pools
+    StringPool(const StringPool &) = delete;
+    StringPool &operator=(const StringPool &) = delete;
+
+    // Returns the handle of s , adding s to the pool the first time it is seen
+    StringHandle intern(StringView s)
+    {
+        if (s.size() > 0xFFFFFFFFu)
+            throw std::length_error("StringPool: String too long.");
+        uint64_t h = hash_of(s);
+        unsigned si = shard_of(h);
+        Shard &sh = shards[si];
+
+        {
+            // Most calls find an existing string , a shared lock lets all those readers run together
+            std::shared_lock<std::shared_mutex> read(sh.lock);
+            int64_t idx = find_in(sh, s, h);
+            if (idx >= 0)
+                return make_handle(si, (uint32_t)idx);
+        }
+
+        std::unique_lock<std::shared_mutex> write(sh.lock);
+        int64_t idx = find_in(sh, s, h); // Another thread may have added it between the two locks
+        if (idx >= 0)
+            return make_handle(si, (uint32_t)idx);
+        return make_handle(si, insert_in(sh, s, h));
+    }
+
+    // Handle of s if it was interned before , otherwise an invalid handle. Never adds anything.
+    StringHandle lookup(StringView s) const
+    {
+        uint64_t h = hash_of(s);
+        unsigned si = shard_of(h);
+        const Shard &sh = shards[si];
+        std::shared_lock<std::shared_mutex> read(sh.lock);
+        int64_t idx = find_in(sh, s, h);
+        return idx >= 0 ? make_handle(si, (uint32_t)idx) : StringHandle();
+    }
+
+    // The text behind a handle. The view (and its c_str) stays valid as long as the pool lives.
+    StringView view(StringHandle h) const
+    {
+        if (!h.valid())
+            throw std::out_of_range("StringPool: Invalid handle");
+        const Shard &sh = shards[h.id() & (SHARDS - 1)];
+        uint32_t idx = h.id() >> SHARD_BITS;
+        std::shared_lock<std::shared_mutex> read(sh.lock); // The entries array may be reallocated by a writer
+        if (idx >= sh.count)
+            throw std::out_of_range("StringPool: Invalid handle");
+        return StringView(sh.entries[idx].ptr, sh.entries[idx].len);
+    }
+
+    const char *c_str(StringHandle h) const { return view(h).data(); } // Stored with a '\0' after it
+
+    String str(StringHandle h) const { return String(view(h)); }
+
+    // Number of distinct strings
+    size_t size() const
+    {
+        size_t n = 0;
+        for (const Shard &sh : shards)
+        {
+            std::shared_lock<std::shared_mutex> read(sh.lock);
+            n += sh.count;
+        }
+        return n;
+    }
+
+    // Approximate bytes held by the pool (chars + entries + hash slots)
+    size_t memory_usage() const
+    {
+        size_t bytes = 0;
+        for (const Shard &sh : shards)
+        {
+            std::shared_lock<std::shared_mutex> read(sh.lock);
+            for (uint32_t i = 0; i < sh.count; i++)
+                bytes += sh.entries[i].len + 1;
+            bytes += sh.entries_cap * sizeof(Entry);
+            bytes += sh.slots ? (sh.mask + 1) * sizeof(uint32_t) : 0;
+        }
+        return bytes;
+    }
+};
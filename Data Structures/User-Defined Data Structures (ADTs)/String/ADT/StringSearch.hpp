@@ -0,0 +1,354 @@
+#pragma once
+#include <cstddef>
+#include <cstring>
+#include <cstdint>
+#include "StringKernels.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#define STRING_SEARCH_AVX2 1
+#endif
+
+// Substring search engine used by StringView and String (find , rfind , find_first_of , find_last_of).
+// The old String::find was the school-book double loop : for every position compare the whole needle,
+// which is O(n * m) and on "aaaa...ab" it really does n * m char compares.
+
+// How find() picks an algorithm :
+// 1) Needle of 1 char : memchr() (already SIMD inside the C library).
+// 2) Otherwise SIMD filter : compare 16 (SSE2) or 32 (AVX2) positions at once against the FIRST and LAST
+//    char of the needle. Only positions where both match are checked fully with memcmp().
+//    On normal text almost no position survives the filter , so this is very fast.
+// 3) Two-Way (Crochemore-Perrin 1991) : O(n + m) time and O(1) extra space in the worst case.
+//    Used directly when there is no SIMD , and as a fallback when the filter is doing too many memcmp()
+//    (adversarial input like "aaaa...ab") , so the total work always stays linear.
+// AVX2 is chosen at runtime (only if the CPU has it) , so the same binary runs everywhere.
+class StringSearch
+{
+public:
+    static const size_t npos = -1;
+
+    // Index of first occurrence of needle[0..m) in hay[0..n) , or npos
+    static size_t find(const char *hay, size_t n, const char *needle, size_t m)
+    {
+        if (m == 0)
+            return 0;
+        if (m > n)
+            return npos;
+        if (m == 1)
+        {
+            const void *hit = memchr(hay, needle[0], n);
+            return hit ? (const char *)hit - hay : npos;
+        }
+
+#if defined(STRING_SEARCH_AVX2)
+        if (StringKernels::has_avx2())
+            return filter_avx2(hay, n, needle, m);
+#endif
+#if defined(__SSE2__)
+        return filter_sse2(hay, n, needle, m);
+#else
+        return two_way(hay, n, needle, m);
+#endif
+    }
+
+    // Index of last occurrence of needle that starts at or before pos , or npos
+    static size_t rfind(const char *hay, size_t n, const char *needle, size_t m, size_t pos = npos)
+    {
+        if (m > n)
+            return npos;
+        size_t start = n - m;
+        if (pos < start)
+            start = pos;
+        if (m == 0)
+            return start;
+
+        // Scan backward checking the first char before paying for memcmp()
+        for (size_t i = start + 1; i-- > 0;)
+        {
+            if (hay[i] == needle[0] && memcmp(hay + i + 1, needle + 1, m - 1) == 0)
+                return i;
+        }
+        return npos;
+    }
+
+    // Index of first char at or after pos that is any of the chars in set[0..k) , or npos
+    static size_t find_first_of(const char *hay, size_t n, const char *set, size_t k, size_t pos = 0)
+    {
+        if (pos >= n || k == 0)
+            return npos;
+        if (k == 1)
+        {
+            const void *hit = memchr(hay + pos, set[0], n - pos);
+            return hit ? (const char *)hit - hay : npos;
+        }
+
+        bool table[256] = {}; // One lookup per char instead of looping over the whole set
+        for (size_t i = 0; i < k; i++)
+            table[(unsigned char)set[i]] = true;
+        for (size_t i = pos; i < n; i++)
+        {
+            if (table[(unsigned char)hay[i]])
+                return i;
+        }
+        return npos;
+    }
+
+    // Index of last char at or before pos that is any of the chars in set[0..k) , or npos
+    static size_t find_last_of(const char *hay, size_t n, const char *set, size_t k, size_t pos = npos)
+    {
+        if (n == 0 || k == 0)
+            return npos;
+        if (pos >= n)
+            pos = n - 1;
+
+        bool table[256] = {};
+        for (size_t i = 0; i < k; i++)
+            table[(unsigned char)set[i]] = true;
+        for (size_t i = pos + 1; i-- > 0;)
+        {
+            if (table[(unsigned char)hay[i]])
+                return i;
+        }
+        return npos;
+    }
+
+    // --- TWO-WAY ---
+    // The needle is cut into two halves u | v at a "critical factorization".
+    // v is matched left to right , then u right to left. On a mismatch the needle jumps forward by an
+    // amount that can never skip a match. For periodic needles (like "abcabc") it also remembers how much of
+    // the needle already matched , so no char of the haystack is compared more than twice.
+    static size_t two_way(const char *hay_c, size_t n, const char *needle_c, size_t m)
+    {
+        if (m == 0)
+            return 0;
+        if (m > n)
+            return npos;
+
+        const unsigned char *hay = (const unsigned char *)hay_c;
+        const unsigned char *needle = (const unsigned char *)needle_c;
+        size_t period;
+        size_t suffix = critical_factorization(needle, m, &period);
+        size_t i, j;
+
+        if (memcmp(needle, needle + period, suffix) == 0)
+        {
+            // Periodic needle : remember how many chars of the left part already matched
+            size_t memory = 0;
+            j = 0;
+            while (j <= n - m)
+            {
+                i = suffix > memory ? suffix : memory;
+                while (i < m && needle[i] == hay[i + j])
+                    i++;
+                if (i >= m)
+                {
+                    i = suffix - 1;
+                    while (memory < i + 1 && needle[i] == hay[i + j])
+                        i--;
+                    if (i + 1 < memory + 1)
+                        return j;
+                    j += period;
+                    memory = m - period;
+                }
+                else
+                {
+                    j += i - suffix + 1;
+                    memory = 0;
+                }
+            }
+        }
+        else
+        {
+            // Non periodic : the halves can't overlap a match , a safe shift is max(|u| , |v|) + 1
+            period = (suffix > m - suffix ? suffix : m - suffix) + 1;
+            j = 0;
+            while (j <= n - m)
+            {
+                i = suffix;
+                while (i < m && needle[i] == hay[i + j])
+                    i++;
+                if (i >= m)
+                {
+                    i = suffix - 1;
+                    while (i != npos && needle[i] == hay[i + j])
+                        i--;
+                    if (i == npos)
+                        return j;
+                    j += period;
+                }
+                else
+                {
+                    j += i - suffix + 1;
+                }
+            }
+        }
+        return npos;
+    }
+
+private:
+    // Returns the start of the right half v , and its period in *period.
+    // Computed as the longer of the two maximal suffixes (for normal and reversed alphabet order).
+    static size_t critical_factorization(const unsigned char *needle, size_t m, size_t *period)
+    {
+        size_t max_suffix, max_suffix_rev, j, k, p;
+        unsigned char a, b;
+
+        // Maximal suffix for '<'
+        max_suffix = npos; // Means -1 , wraps to 0 when 1 is added
+        j = 0;
+        k = p = 1;
+        while (j + k < m)
+        {
+            a = needle[j + k];
+            b = needle[max_suffix + k];
+            if (a < b)
+            {
+                j += k;
+                k = 1;
+                p = j - max_suffix;
+            }
+            else if (a == b)
+            {
+                if (k != p)
+                    k++;
+                else
+                {
+                    j += p;
+                    k = 1;
+                }
+            }
+            else
+            {
+                max_suffix = j++;
+                k = p = 1;
+            }
+        }
+        *period = p;
+
+        // Maximal suffix for '>'
+        max_suffix_rev = npos;
+        j = 0;
+        k = p = 1;
+        while (j + k < m)
+        {
+            a = needle[j + k];
+            b = needle[max_suffix_rev + k];
+            if (b < a)
+            {
+                j += k;
+                k = 1;
+                p = j - max_suffix_rev;
+            }
+            else if (a == b)
+            {
+                if (k != p)
+                    k++;
+                else
+                {
+                    j += p;
+                    k = 1;
+                }
+            }
+            else
+            {
+                max_suffix_rev = j++;
+                k = p = 1;
+            }
+        }
+
+        // Choose the longer suffix
+        if (max_suffix_rev + 1 < max_suffix + 1)
+            return max_suffix + 1;
+        *period = p;
+        return max_suffix_rev + 1;
+    }
+
+    // The SIMD filter gives up and hands over to Two-Way when memcmp() work grows past this many
+    // bytes per haystack byte scanned. Keeps "aaaa...ab" linear while normal text never gets near it.
+    static const size_t VERIFY_BUDGET = 4;
+
+    // Checks one candidate position found by the filter , adding its cost to the work done so far
+    static bool verify(const char *at, const char *needle, size_t m, size_t &work)
+    {
+        work += m;
+        return memcmp(at + 1, needle + 1, m - 2) == 0;
+    }
+
+    // Positions the SIMD loop didn't cover (the last few) , checked one by one
+    static size_t tail(const char *hay, size_t n, const char *needle, size_t m, size_t i)
+    {
+        for (; i + m <= n; i++)
+        {
+            if (hay[i] == needle[0] && hay[i + m - 1] == needle[m - 1] &&
+                memcmp(hay + i + 1, needle + 1, m - 2) == 0)
+                return i;
+        }
+        return npos;
+    }
+
+    // Continues with Two-Way from position i (nothing before i can match)
+    static size_t fallback(const char *hay, size_t n, const char *needle, size_t m, size_t i)
+    {
+        size_t r = two_way(hay + i, n - i, needle, m);
+        return r == npos ? npos : r + i;
+    }
+
+#if defined(__SSE2__)
+    static size_t filter_sse2(const char *hay, size_t n, const char *needle, size_t m)
+    {
+        const __m128i first = _mm_set1_epi8(needle[0]);
+        const __m128i last = _mm_set1_epi8(needle[m - 1]);
+        size_t work = 0;
+        size_t i = 0;
+
+        for (; i + m - 1 + 16 <= n; i += 16)
+        {
+            __m128i block_first = _mm_loadu_si128((const __m128i *)(hay + i));
+            __m128i block_last = _mm_loadu_si128((const __m128i *)(hay + i + m - 1));
+            unsigned mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(block_first, first),
+                                                            _mm_cmpeq_epi8(block_last, last)));
+            while (mask != 0)
+            {
+                unsigned bit = __builtin_ctz(mask);
+                if (verify(hay + i + bit, needle, m, work))
+                    return i + bit;
+                mask &= mask - 1;
+            }
+            if (work > VERIFY_BUDGET * (i + 16) + 1024)
+                return fallback(hay, n, needle, m, i + 16);
+        }
+        return tail(hay, n, needle, m, i);
+    }
+#endif
+
+#if defined(STRING_SEARCH_AVX2)
+    __attribute__((target("avx2"))) static size_t filter_avx2(const char *hay, size_t n, const char *needle, size_t m)
+    {
+        const __m256i first = _mm256_set1_epi8(needle[0]);
+        const __m256i last = _mm256_set1_epi8(needle[m - 1]);
+        size_t work = 0;
+        size_t i = 0;
+
+        for (; i + m - 1 + 32 <= n; i += 32)
+        {
+            __m256i block_first = _mm256_loadu_si256((const __m256i *)(hay + i));
+            __m256i block_last = _mm256_loadu_si256((const __m256i *)(hay + i + m - 1));
+            unsigned mask = (unsigned)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(block_first, first),
+                                                                            _mm256_cmpeq_epi8(block_last, last)));
+            while (mask != 0)
+            {
+                unsigned bit = __builtin_ctz(mask);
+                if (verify(hay + i + bit, needle, m, work))
+                    return i + bit;
+                mask &= mask - 1;
+            }
+            if (work > VERIFY_BUDGET * (i + 32) + 1024)
+                return fallback(hay, n, needle, m, i + 32);
+        }
+        return tail(hay, n, needle, m, i);
+    }
+#endif
+};
@@ -0,0 +1,180 @@
+#pragma once
+#include <iostream>
+#include <stdexcept>
+#include <cstring>
+#include <functional>
+#include "StringKernels.hpp"
+#include "StringSearch.hpp"
+#include "StringHash.hpp"
+
+// StringView : A non-owning "window" over chars that live somewhere else (See String.txt).
+// It is just a pointer + a length (16 bytes) , so it is copied by value like an int.
+// Nothing here ever allocates : substr() only moves the pointer and changes the length.
+// Our String converts to it implicitly , so a function taking StringView accepts
+// String , "literals" and char arrays without building any temporary String.
+
+// Because it doesn't own the memory , the real string must stay alive as long as the view is used.
+// Also a view is NOT '\0' terminated (a substr of "Hello World" may end in the middle) , so there is no c_str().
+class StringView
+{
+private:
+    const char *_ptr;
+    size_t _len;
+
+    static size_t get_len(const char *s)
+    {
+        return s ? StringKernels::length(s) : 0;
+    }
+
+public:
+    static const size_t npos = -1;
+
+    // --- CONSTRUCTORS ---
+    StringView() : _ptr(""), _len(0) {}
+    StringView(const char *s) : _ptr(s ? s : ""), _len(get_len(s)) {} // O(n) once , to find the length
+    StringView(const char *s, size_t n) : _ptr(s), _len(n) {}
+
+    // --- ELEMENT ACCESS ---
+    const char &operator[](size_t idx) const { return _ptr[idx]; }
+
+    const char &at(size_t idx) const
+    {
+        if (idx >= _len)
+            throw std::out_of_range("StringView: Index out of bounds");
+        return _ptr[idx];
+    }
+
+    const char &front() const { return _ptr[0]; }
+    const char &back() const { return _ptr[_len - 1]; }
+    const char *data() const { return _ptr; }
+
+    // Plain pointers are enough as iterators for a read-only view
+    const char *begin() const { return _ptr; }
+    const char *end() const { return _ptr + _len; }
+
+    // --- CAPACITY ---
+    size_t size() const { return _len; }
+    size_t length() const { return _len; }
+    bool empty() const { return _len == 0; }
+
+    // --- MODIFIERS (Only the window moves , the chars are never touched) ---
+    void remove_prefix(size_t n)
+    {
+        if (n > _len)
+            n = _len;
+        _ptr += n;
+        _len -= n;
+    }
+
+    void remove_suffix(size_t n)
+    {
+        if (n > _len)
+            n = _len;
+        _len -= n;
+    }
+
+    // --- SUBSTRING (O(1) , No allocation) ---
+    // Unlike String::substr , pos == size() is allowed and gives an empty view (handy while tokenizing)
+    StringView substr(size_t pos, size_t len = npos) const
+    {
+        if (pos > _len)
+            throw std::out_of_range("StringView: Substr error");
+        if (len == npos || pos + len > _len)
+            len = _len - pos;
+        return StringView(_ptr + pos, len);
+    }
+
+    // --- SEARCH ---
+    size_t find(char c, size_t pos = 0) const
+    {
+        if (pos >= _len)
+            return npos;
+        const void *hit = memchr(_ptr + pos, c, _len - pos);
+        return hit ? (const char *)hit - _ptr : npos;
+    }
+
+    // Picks memchr / SIMD filter / Two-Way depending on the needle (See StringSearch.hpp) , always linear
+    size_t find(StringView s, size_t pos = 0) const
+    {
+        if (pos > _len)
+            return npos;
+        size_t r = StringSearch::find(_ptr + pos, _len - pos, s._ptr, s._len);
+        return r == npos ? npos : r + pos;
+    }
+
+    // Last occurrence of s starting at or before pos
+    size_t rfind(StringView s, size_t pos = npos) const
+    {
+        return StringSearch::rfind(_ptr, _len, s._ptr, s._len, pos);
+    }
+
+    // First / last char that is any of the chars of set , e.g find_first_of(" \t\r\n")
+    size_t find_first_of(StringView set, size_t pos = 0) const
+    {
+        return StringSearch::find_first_of(_ptr, _len, set._ptr, set._len, pos);
+    }
+
+    size_t find_last_of(StringView set, size_t pos = npos) const
+    {
+        return StringSearch::find_last_of(_ptr, _len, set._ptr, set._len, pos);
+    }
+
+    bool contains(StringView s) const { return find(s) != npos; }
+
+    bool starts_with(StringView s) const
+    {
+        return _len >= s._len && memcmp(_ptr, s._ptr, s._len) == 0;
+    }
+
+    bool ends_with(StringView s) const
+    {
+        return _len >= s._len && memcmp(_ptr + _len - s._len, s._ptr, s._len) == 0;
+    }
+
+    // --- COMPARISON ---
+    // Lexicographic : < 0 if this comes first , 0 if equal , > 0 if other comes first
+    int compare(StringView other) const
+    {
+        size_t n = _len < other._len ? _len : other._len;
+        int r = StringKernels::compare(_ptr, other._ptr, n);
+        if (r != 0)
+            return r;
+        if (_len == other._len)
+            return 0;
+        return _len < other._len ? -1 : 1;
+    }
+
+    // Friends (not members) so "abc" == view works as well as view == "abc"
+    friend bool operator==(StringView a, StringView b)
+    {
+        return a._len == b._len && StringKernels::equal(a._ptr, b._ptr, a._len);
+    }
+    friend bool operator!=(StringView a, StringView b) { return !(a == b); }
+    friend bool operator<(StringView a, StringView b) { return a.compare(b) < 0; }
+    friend bool operator>(StringView a, StringView b) { return a.compare(b) > 0; }
+    friend bool operator<=(StringView a, StringView b) { return a.compare(b) <= 0; }
+    friend bool operator>=(StringView a, StringView b) { return a.compare(b) >= 0; }
+
+    // --- HASHING ---
+    // wyhash (See StringHash.hpp) , equal chars give equal hashes for StringView , String and SharedString alike
+    size_t hash() const
+    {
+        return (size_t)StringHash::hash(_ptr, _len);
+    }
+
+    friend std::ostream &operator<<(std::ostream &os, StringView s)
+    {
+        os.write(s._ptr, s._len); // Can't use << on the pointer , the view is not '\0' terminated
+        return os;
+    }
+};
+
+// Allows std::unordered_map<StringView, T> and std::unordered_set<StringView>
+namespace std
+{
+    template <>
+    struct hash<StringView>
+    {
+        size_t operator()(StringView s) const { return s.hash(); }
+    };
+}
@@ -0,0 +1,991 @@
+#include "String.hpp"
+#include "StringBuilder.hpp"
+#include "Rope.hpp"
+#include "SharedString.hpp"
+#include "StringPool.hpp"
+#include "LineReader.hpp"
+#include "MappedFile.hpp"
+#include "AlternatingFlips.hpp"
+#include "PatternDistance.hpp"
+#include <iostream>
+#include <chrono>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <string_view>
+#include <unordered_set>
+
+// Benchmarks for String.hpp
+// Compile with optimizations on , otherwise the numbers mean nothing :
+// g++ -std=c++17 -O2 -pthread benchmark.cpp -o benchmark
+// ./benchmark            -> in-memory benchmarks (sections 1 - 11 , 14)
+// ./benchmark io [MB]    -> big input benchmarks (sections 12 - 13 , 15) on a generated file of MB megabytes (default 1024) , written to /tmp
+//                           (./benchmark io 4096 for the 4 GB case , it needs that much free disk and RAM for the String copy)
+
+using Clock = std::chrono::steady_clock;
+
+double ms_since(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// Defeats the optimizer so the strings are really built
+volatile size_t sink = 0;
+
+// The old heap-only layout of String.hpp (every string calls new) kept here for comparison only.
+class HeapString
+{
+    char *_data;
+    size_t _size;
+    size_t _capacity;
+
+public:
+    HeapString(const char *s)
+    {
+        _size = strlen(s);
+        _capacity = _size + 16;
+        _data = new char[_capacity];
+        memcpy(_data, s, _size + 1);
+    }
+    HeapString(const HeapString &other) : _size(other._size), _capacity(other._size + 1)
+    {
+        _data = new char[_capacity];
+        memcpy(_data, other._data, _size + 1);
+    }
+    ~HeapString() { delete[] _data; }
+    size_t size() const { return _size; }
+};
+
+// --- 1. Small String Optimization : construct and copy short strings ---
+template <typename Str>
+double construct_and_copy(const char *const *keys, int nkeys, int n)
+{
+    auto start = Clock::now();
+    for (int i = 0; i < n; i++)
+    {
+        Str s(keys[i % nkeys]);
+        Str copy(s);
+        sink = sink + copy.size();
+    }
+    return ms_since(start);
+}
+
+void bench_sso(int n)
+{
+    const char *keys[] = {"id", "user_name", "timestamp", "status", "GET", "200", "content-type", "en-US"};
+    int nkeys = sizeof(keys) / sizeof(keys[0]);
+
+    std::cout << "--- 1. Construct + copy " << n << " short strings (<= 15 chars) ---" << std::endl;
+    std::cout << "sizeof(String) = " << sizeof(String) << " bytes" << std::endl;
+    std::cout << "heap-only layout : " << construct_and_copy<HeapString>(keys, nkeys, n) << " ms" << std::endl;
+    std::cout << "SSO layout       : " << construct_and_copy<String>(keys, nkeys, n) << " ms" << std::endl;
+    std::cout << std::endl;
+}
+
+// --- 2. StringView : slicing request lines with zero heap traffic ---
+const char *REQUEST_LINES[] = {
+    "GET /api/v1/users/12345/profile?fields=name,email,avatar HTTP/1.1",
+    "POST /api/v1/orders/checkout/confirmation-page HTTP/1.1",
+    "Accept-Language: en-US,en;q=0.9,de;q=0.8,fr;q=0.7",
+    "User-Agent: Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36",
+};
+
+// Old way : every token is a new String made by substr()
+size_t tokenize_with_substr(const String &line)
+{
+    size_t total = 0, start = 0;
+    while (start < line.size())
+    {
+        size_t sp = line.find(' ', start);
+        if (sp == String::npos)
+            sp = line.size();
+        String token = line.substr(start, sp - start);
+        total += token.size();
+        start = sp + 1;
+    }
+    return total;
+}
+
+// New way : every token is a StringView pointing into the line
+size_t tokenize_with_view(StringView line)
+{
+    size_t total = 0;
+    while (!line.empty())
+    {
+        size_t sp = line.find(' ');
+        StringView token = line.substr(0, sp);
+        total += token.size();
+        line.remove_prefix(sp == StringView::npos ? line.size() : sp + 1);
+    }
+    return total;
+}
+
+void bench_view(int n)
+{
+    const int NLINES = sizeof(REQUEST_LINES) / sizeof(REQUEST_LINES[0]);
+    String lines[NLINES];
+    for (int i = 0; i < NLINES; i++)
+        lines[i] = String(REQUEST_LINES[i]);
+
+    std::cout << "--- 2. Tokenize " << n << " request lines on ' ' ---" << std::endl;
+
+    auto start = Clock::now();
+    for (int i = 0; i < n; i++)
+        sink = sink + tokenize_with_substr(lines[i % NLINES]);
+    std::cout << "find + substr (String) : " << ms_since(start) << " ms" << std::endl;
+
+    start = Clock::now();
+    for (int i = 0; i < n; i++)
+        sink = sink + tokenize_with_view(lines[i % NLINES]);
+    std::cout << "StringView slicing     : " << ms_since(start) << " ms" << std::endl;
+    std::cout << std::endl;
+}
+
+// --- 3. Substring search engine vs the old double loop ---
+// The old String::find , kept here for comparison only
+size_t naive_find(const char *hay, size_t n, const char *needle, size_t m)
+{
+    for (size_t i = 0; i + m <= n; i++)
+    {
+        size_t j = 0;
+        while (j < m && hay[i + j] == needle[j])
+            j++;
+        if (j == m)
+            return i;
+    }
+    return String::npos;
+}
+
+void search_case(const char *label, const String &hay, const String &needle, int reps)
+{
+    auto start = Clock::now();
+    for (int r = 0; r < reps; r++)
+        sink = sink + naive_find(hay.c_str(), hay.size(), needle.c_str(), needle.size());
+    double naive_ms = ms_since(start) / reps;
+
+    start = Clock::now();
+    for (int r = 0; r < reps; r++)
+        sink = sink + hay.find(needle);
+    double engine_ms = ms_since(start) / reps;
+
+    double mb = hay.size() / (1024.0 * 1024.0);
+    std::cout << label << " (m = " << needle.size() << ") : naive " << mb / naive_ms * 1000 << " MB/s"
+              << " | engine " << mb / engine_ms * 1000 << " MB/s" << std::endl;
+}
+
+void bench_search(size_t n)
+{
+    std::cout << "--- 3. find() over a " << n / (1024 * 1024) << " MB haystack (needles not present) ---" << std::endl;
+
+    // Random lowercase text
+    String text;
+    text.reserve(n + 1);
+    unsigned x = 12345;
+    for (size_t i = 0; i < n; i++)
+    {
+        x = x * 1103515245 + 12345; // Small LCG , good enough for text
+        text.push_back('a' + (x >> 16) % 26);
+    }
+    search_case("random      ", text, "qzxjwv", 5);
+    search_case("random      ", text, "zqxjwvkyzqxjwvky", 5);
+    search_case("random      ", text, String(64, 'q'), 5);
+
+    // Adversarial : "aaaa...a" searched for "aaa...ab" , every position matches almost the whole needle
+    String same(n, 'a');
+    String needle8(7, 'a');
+    needle8.push_back('b');
+    String needle64(63, 'a');
+    needle64.push_back('b');
+    search_case("adversarial ", same, needle8, 2);
+    search_case("adversarial ", same, needle64, 2);
+    std::cout << std::endl;
+}
+
+// --- 4. Building a big string out of small appends ---
+// Old policy : append reserved exactly the size it needed , so every append copied the whole string
+double build_exact_fit(size_t total, StringView piece)
+{
+    auto start = Clock::now();
+    String s;
+    while (s.size() < total)
+    {
+        s.reserve(s.size() + piece.size() + 1);
+        s.append(piece);
+    }
+    sink = sink + s.size();
+    return ms_since(start);
+}
+
+// New policy : append / insert / push_back all grow by the string type's Growth policy
+template <typename S = String>
+double build_geometric(size_t total, StringView piece)
+{
+    auto start = Clock::now();
+    S s;
+    while (s.size() < total)
+        s += piece;
+    sink = sink + s.size();
+    return ms_since(start);
+}
+
+void bench_append()
+{
+    const char *piece = "field=42, "; // 10 bytes
+    const size_t SMALL = 256 * 1024;
+    const size_t BIG = 100 * 1024 * 1024;
+
+    std::cout << "--- 4. Build a string out of 10-byte appends ---" << std::endl;
+    std::cout << "256 KB , exact-fit reserve : " << build_exact_fit(SMALL, piece) << " ms" << std::endl;
+    std::cout << "256 KB , geometric (x2)    : " << build_geometric(SMALL, piece) << " ms" << std::endl;
+    // Exact-fit at 100 MB would copy ~500 TB in total , so it is not run
+    std::cout << "100 MB , geometric (x2)    : " << build_geometric(BIG, piece) << " ms" << std::endl;
+    using String15 = BasicString<std::allocator<char>, GeometricGrowth<3, 2>>;
+    std::cout << "100 MB , geometric (x1.5)  : " << build_geometric<String15>(BIG, piece) << " ms" << std::endl;
+    std::cout << std::endl;
+}
+
+// --- 5. Rope vs String::insert : edits in the middle of a 10 MB document ---
+void bench_rope(size_t n, int edits)
+{
+    String doc(n, 'x');
+    Rope rope(doc);
+    const char *word = "inserted ";
+    unsigned x = 777;
+
+    std::cout << "--- 5. " << edits << " inserts at random positions of a " << n / (1024 * 1024) << " MB text ---" << std::endl;
+
+    auto start = Clock::now();
+    for (int i = 0; i < edits; i++)
+    {
+        x = x * 1103515245 + 12345;
+        doc.insert(x % doc.size(), word);
+    }
+    std::cout << "String::insert : " << ms_since(start) << " ms" << std::endl;
+
+    x = 777;
+    start = Clock::now();
+    for (int i = 0; i < edits; i++)
+    {
+        x = x * 1103515245 + 12345;
+        rope.insert(x % rope.size(), word);
+    }
+    std::cout << "Rope::insert   : " << ms_since(start) << " ms" << std::endl;
+
+    // Same positions , so both must hold the same text
+    std::cout << "Same text      : " << (rope.to_string() == doc ? "yes" : "NO") << std::endl;
+    std::cout << std::endl;
+}
+
+// --- 6. StringBuilder : a response body out of many fragments ---
+void bench_builder(int fragments)
+{
+    const char *parts[] = {"<li>", "item-", "42", "</li>\n"};
+
+    std::cout << "--- 6. Concatenate " << fragments << " fragments ---" << std::endl;
+
+    auto start = Clock::now();
+    String s;
+    for (int i = 0; i < fragments; i++)
+        s += parts[i % 4];
+    sink = sink + s.size();
+    std::cout << "String +=     : " << ms_since(start) << " ms" << std::endl;
+
+    start = Clock::now();
+    StringBuilder sb;
+    for (int i = 0; i < fragments; i++)
+        sb << parts[i % 4];
+    String built = sb.str();
+    sink = sink + built.size();
+    std::cout << "StringBuilder : " << ms_since(start) << " ms (including str())" << std::endl;
+    std::cout << std::endl;
+}
+
+// --- 7. SIMD kernels : equality and sorting of 1M strings ---
+// The old byte loops , kept here for comparison only
+bool loop_equal(const String &a, const String &b)
+{
+    if (a.size() != b.size())
+        return false;
+    for (size_t i = 0; i < a.size(); i++)
+        if (a[i] != b[i])
+            return false;
+    return true;
+}
+
+bool loop_less(const String &a, const String &b)
+{
+    size_t n = a.size() < b.size() ? a.size() : b.size();
+    for (size_t i = 0; i < n; i++)
+    {
+        if (a[i] != b[i])
+            return (unsigned char)a[i] < (unsigned char)b[i];
+    }
+    return a.size() < b.size();
+}
+
+void bench_compare(int n)
+{
+    // Keys share a long prefix , like paths or URLs , so comparisons must look past it
+    std::vector<String> keys;
+    keys.reserve(n);
+    unsigned x = 99;
+    for (int i = 0; i < n; i++)
+    {
+        String k("/api/v1/customers/");
+        x = x * 1103515245 + 12345;
+        size_t len = 8 + (x >> 16) % 40;
+        for (size_t j = 0; j < len; j++)
+        {
+            x = x * 1103515245 + 12345;
+            k.push_back('a' + (x >> 16) % 4);
+        }
+        keys.push_back(k);
+    }
+    std::vector<String> copies(keys);
+
+    std::cout << "--- 7. Compare " << n << " strings ---" << std::endl;
+
+    auto start = Clock::now();
+    size_t same = 0;
+    for (int r = 0; r < 10; r++)
+        for (int i = 0; i < n; i++)
+            same += loop_equal(keys[i], copies[(i + r) % n]);
+    std::cout << "equality , byte loop : " << ms_since(start) << " ms" << std::endl;
+
+    start = Clock::now();
+    for (int r = 0; r < 10; r++)
+        for (int i = 0; i < n; i++)
+            same += keys[i] == copies[(i + r) % n];
+    std::cout << "equality , kernels   : " << ms_since(start) << " ms" << std::endl;
+    sink = sink + same;
+
+    std::vector<String> a(keys), b(keys);
+    start = Clock::now();
+    std::sort(a.begin(), a.end(), loop_less);
+    std::cout << "std::sort , byte loop : " << ms_since(start) << " ms" << std::endl;
+
+    start = Clock::now();
+    std::sort(b.begin(), b.end()); // operator<
+    std::cout << "std::sort , kernels   : " << ms_since(start) << " ms" << std::endl;
+    std::cout << std::endl;
+}
+
+// --- 8. Number formatting / parsing throughput ---
+// The old String::to_string(int) : one division per digit , then reverse
+char *old_to_chars(char *buf, int val)
+{
+    int i = 0;
+    long long n = (val < 0) ? -(long long)val : val;
+    do
+    {
+        buf[i++] = (n % 10) + '0';
+        n /= 10;
+    } while (n > 0);
+    if (val < 0)
+        buf[i++] = '-';
+    for (int j = 0; j < i / 2; j++)
+    {
+        char t = buf[j];
+        buf[j] = buf[i - j - 1];
+        buf[i - j - 1] = t;
+    }
+    return buf + i;
+}
+
+template <typename F>
+void report(const char *label, int n, F &&body)
+{
+    auto start = Clock::now();
+    for (int i = 0; i < n; i++)
+        body(i);
+    double ms = ms_since(start);
+    std::cout << label << " : " << n / ms / 1000 << " M/s" << std::endl;
+}
+
+void bench_numbers(int n)
+{
+    std::vector<int> ints(n);
+    std::vector<unsigned long long> longs(n);
+    std::vector<double> doubles(n);
+    unsigned long long x = 88172645463325252ULL;
+    for (int i = 0; i < n; i++)
+    {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        ints[i] = (int)x;
+        longs[i] = x >> (x % 64); // Every length from 1 to 20 digits
+        doubles[i] = (double)(x % 10000000) / 100.0; // Metric like values : 12345.67
+    }
+
+    // Text versions for the parsers
+    std::vector<String> int_text(n), double_text(n);
+    for (int i = 0; i < n; i++)
+    {
+        int_text[i] = String::to_string(longs[i]);
+        double_text[i] = String::to_string(doubles[i]);
+    }
+
+    char buf[32];
+    std::cout << "--- 8. Convert " << n << " numbers ---" << std::endl;
+    report("int    -> text , old to_string   ", n, [&](int i)
+           { sink = sink + (old_to_chars(buf, ints[i]) - buf); });
+    report("int    -> text , std::to_chars   ", n, [&](int i)
+           { sink = sink + (std::to_chars(buf, buf + 32, ints[i]).ptr - buf); });
+    report("int    -> text , String::to_chars", n, [&](int i)
+           { sink = sink + (String::to_chars(buf, buf + 32, ints[i]).ptr - buf); });
+    report("u64    -> text , std::to_chars   ", n, [&](int i)
+           { sink = sink + (std::to_chars(buf, buf + 32, longs[i]).ptr - buf); });
+    report("u64    -> text , String::to_chars", n, [&](int i)
+           { sink = sink + (String::to_chars(buf, buf + 32, longs[i]).ptr - buf); });
+    report("double -> text , snprintf %.17g  ", n, [&](int i)
+           { sink = sink + snprintf(buf, 32, "%.17g", doubles[i]); });
+    report("double -> text , String::to_chars", n, [&](int i)
+           { sink = sink + (String::to_chars(buf, buf + 32, doubles[i]).ptr - buf); });
+
+    unsigned long long u = 0;
+    double d = 0;
+    report("text -> u64    , std::from_chars   ", n, [&](int i)
+           { std::from_chars(int_text[i].c_str(), int_text[i].c_str() + int_text[i].size(), u); sink = sink + u; });
+    report("text -> u64    , String::from_chars", n, [&](int i)
+           { String::from_chars(int_text[i], u); sink = sink + u; });
+    report("text -> double , strtod            ", n, [&](int i)
+           { d = strtod(double_text[i].c_str(), nullptr); sink = sink + (size_t)d; });
+    report("text -> double , std::from_chars   ", n, [&](int i)
+           { std::from_chars(double_text[i].c_str(), double_text[i].c_str() + double_text[i].size(), d); sink = sink + (size_t)d; });
+    report("text -> double , String::from_chars", n, [&](int i)
+           { String::from_chars(double_text[i], d); sink = sink + (size_t)d; });
+    std::cout << std::endl;
+}
+
+// --- 9. SharedString : config values copied into many objects on many threads ---
+const char *CONFIG[] = {
+    "database.url=postgres://db.internal.example.com:5432/orders",
+    "cache.url=redis://cache.internal.example.com:6379/0",
+    "service.name=order-processing-service-eu-west-1",
+    "log.format=%timestamp% [%level%] %logger% - %message%",
+};
+const int NCONFIG = sizeof(CONFIG) / sizeof(CONFIG[0]);
+
+// Every "request handler" object gets its own copy of every config value
+template <typename Str>
+double copy_configs(int threads, int objects_per_thread)
+{
+    Str config[NCONFIG];
+    for (int i = 0; i < NCONFIG; i++)
+        config[i] = Str(CONFIG[i]);
+
+    auto work = [&config, objects_per_thread]()
+    {
+        size_t total = 0;
+        for (int i = 0; i < objects_per_thread; i++)
+        {
+            Str handler[NCONFIG] = {config[0], config[1], config[2], config[3]};
+            total += handler[i % NCONFIG].size();
+        }
+        sink = sink + total;
+    };
+
+    auto start = Clock::now();
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; t++)
+        pool.emplace_back(work);
+    for (std::thread &t : pool)
+        t.join();
+    return ms_since(start);
+}
+
+void bench_shared(int objects_per_thread)
+{
+    int threads = std::thread::hardware_concurrency();
+    if (threads < 2)
+        threads = 2;
+
+    std::cout << "--- 9. " << threads << " threads x " << objects_per_thread << " objects , "
+              << NCONFIG << " config strings copied into each ---" << std::endl;
+    std::cout << "String (deep copy)      : " << copy_configs<String>(threads, objects_per_thread) << " ms" << std::endl;
+    std::cout << "SharedString (refcount) : " << copy_configs<SharedString>(threads, objects_per_thread) << " ms" << std::endl;
+
+    // Memory each handler object holds for its copies
+    size_t deep = 0;
+    for (int i = 0; i < NCONFIG; i++)
+        deep += sizeof(String) + strlen(CONFIG[i]) + 1; // A copy allocates size + 1
+    std::cout << "Bytes per object : String " << deep << " | SharedString " << NCONFIG * sizeof(SharedString) << std::endl;
+    std::cout << std::endl;
+}
+
+// --- 10. StringPool : millions of repeated tokens ---
+void bench_pool(int n, int distinct)
+{
+    // Token texts : distinct words of 6 to 30 chars (short ones fit in SSO , long ones need the heap)
+    std::vector<String> words;
+    unsigned x = 4242;
+    for (int i = 0; i < distinct; i++)
+    {
+        x = x * 1103515245 + 12345;
+        String w("tok_");
+        w.append_number(i);
+        size_t len = 6 + (x >> 16) % 25;
+        while (w.size() < len)
+            w.push_back('a' + w.size() % 26);
+        words.push_back(w);
+    }
+    std::vector<int> picks(n);
+    for (int i = 0; i < n; i++)
+    {
+        x = x * 1103515245 + 12345;
+        picks[i] = (x >> 8) % distinct;
+    }
+
+    std::cout << "--- 10. " << n << " tokens , " << distinct << " distinct ---" << std::endl;
+
+    auto start = Clock::now();
+    std::vector<String> raw;
+    raw.reserve(n);
+    for (int i = 0; i < n; i++)
+        raw.push_back(words[picks[i]]);
+    std::cout << "store as String    : " << ms_since(start) << " ms" << std::endl;
+
+    StringPool pool;
+    start = Clock::now();
+    std::vector<StringHandle> handles;
+    handles.reserve(n);
+    for (int i = 0; i < n; i++)
+        handles.push_back(pool.intern(words[picks[i]]));
+    std::cout << "intern (1 thread)  : " << ms_since(start) << " ms" << std::endl;
+
+    // Same work split over threads , all hitting the same pool
+    int threads = std::thread::hardware_concurrency();
+    if (threads < 2)
+        threads = 2;
+    StringPool shared_pool;
+    start = Clock::now();
+    std::vector<std::thread> pool_threads;
+    for (int t = 0; t < threads; t++)
+    {
+        pool_threads.emplace_back([&, t]()
+                                  {
+            for (int i = t; i < n; i += threads)
+                sink = sink + shared_pool.intern(words[picks[i]]).id(); });
+    }
+    for (std::thread &t : pool_threads)
+        t.join();
+    std::cout << "intern (" << threads << " threads) : " << ms_since(start) << " ms" << std::endl;
+
+    size_t raw_bytes = raw.size() * sizeof(String);
+    for (const String &s : raw)
+        if (!s.is_local())
+            raw_bytes += s.capacity();
+    size_t pool_bytes = handles.size() * sizeof(StringHandle) + pool.memory_usage();
+    std::cout << "memory : String " << raw_bytes / (1024 * 1024) << " MB | handles + pool "
+              << pool_bytes / (1024 * 1024) << " MB" << std::endl;
+
+    // Lookup : count how often one token appears
+    const String &query = words[picks[0]];
+    start = Clock::now();
+    size_t hits = 0;
+    for (int r = 0; r < 10; r++)
+        for (const String &s : raw)
+            hits += s == query;
+    std::cout << "count matches , String ==  : " << ms_since(start) << " ms" << std::endl;
+
+    StringHandle qh = pool.lookup(query);
+    start = Clock::now();
+    for (int r = 0; r < 10; r++)
+        for (StringHandle h : handles)
+            hits += h == qh;
+    std::cout << "count matches , handle ==  : " << ms_since(start) << " ms" << std::endl;
+    sink = sink + hits;
+    std::cout << std::endl;
+}
+
+// --- 11. Hashing : throughput and quality ---
+// The old StringView::hash , kept here for comparison only
+uint64_t fnv1a(const char *p, size_t n)
+{
+    uint64_t h = 14695981039346656037ULL;
+    for (size_t i = 0; i < n; i++)
+    {
+        h ^= (unsigned char)p[i];
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+template <typename F>
+double hash_gbps(const String &data, size_t len, F &&fn)
+{
+    size_t total = 256 * 1024 * 1024; // Bytes hashed per measurement
+    size_t calls = total / len;
+    size_t span = data.size() - len;
+    auto start = Clock::now();
+    for (size_t i = 0; i < calls; i++)
+        sink = sink + fn(data.c_str() + (i * 64) % span, len);
+    return total / (ms_since(start) / 1000) / 1e9;
+}
+
+// Average number of output bits that flip when one input bit flips (ideal : 32 of 64)
+template <typename F>
+double avalanche(F &&fn)
+{
+    unsigned x = 31337;
+    double flipped = 0;
+    int trials = 0;
+    char key[16];
+    for (int t = 0; t < 2000; t++)
+    {
+        for (char &c : key)
+        {
+            x = x * 1103515245 + 12345;
+            c = (char)(x >> 16);
+        }
+        uint64_t base = fn(key, sizeof(key));
+        for (int bit = 0; bit < 128; bit++)
+        {
+            key[bit / 8] ^= (char)(1 << (bit % 8));
+            flipped += __builtin_popcountll(base ^ fn(key, sizeof(key)));
+            key[bit / 8] ^= (char)(1 << (bit % 8));
+            trials++;
+        }
+    }
+    return flipped / trials;
+}
+
+// Sequential keys "key_0" , "key_1" ... into 2^16 buckets by the LOW bits (what a hash table uses)
+template <typename F>
+void quality(const char *label, F &&fn, int n)
+{
+    const int BUCKETS = 1 << 16;
+    std::vector<int> count(BUCKETS, 0);
+    std::unordered_set<uint64_t> seen;
+    size_t collisions64 = 0;
+    for (int i = 0; i < n; i++)
+    {
+        String k("key_");
+        k.append_number(i);
+        uint64_t h = fn(k.c_str(), k.size());
+        count[h & (BUCKETS - 1)]++;
+        collisions64 += !seen.insert(h).second;
+    }
+    // Chi-square / buckets should be close to 1 for a uniform hash
+    double expected = (double)n / BUCKETS, chi = 0;
+    int worst = 0;
+    for (int c : count)
+    {
+        chi += (c - expected) * (c - expected) / expected;
+        worst = c > worst ? c : worst;
+    }
+    std::cout << label << " : 64-bit collisions " << collisions64 << " | chi2/buckets " << chi / BUCKETS
+              << " | fullest bucket " << worst << " (mean " << expected << ")"
+              << " | avalanche " << avalanche(fn) << " bits" << std::endl;
+}
+
+void bench_hash()
+{
+    String data(65536 + 4096, 'x');
+    unsigned x = 5;
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        x = x * 1103515245 + 12345;
+        data[i] = (char)(x >> 16);
+    }
+
+    auto old_hash = [](const char *p, size_t n) -> uint64_t
+    { return fnv1a(p, n); };
+    auto new_hash = [](const char *p, size_t n) -> uint64_t
+    { return StringView(p, n).hash(); };
+    auto std_hash = [](const char *p, size_t n) -> uint64_t
+    { return std::hash<std::string_view>()(std::string_view(p, n)); };
+
+    std::cout << "--- 11. Hash throughput (GB/s) ---" << std::endl;
+    const size_t sizes[] = {8, 64, 512, 4096, 65536};
+    for (size_t len : sizes)
+    {
+        std::cout << len << " B : FNV-1a " << hash_gbps(data, len, old_hash)
+                  << " | std::hash " << hash_gbps(data, len, std_hash)
+                  << " | String::hash " << hash_gbps(data, len, new_hash) << std::endl;
+    }
+
+    std::cout << "Quality , 1M sequential keys :" << std::endl;
+    quality("FNV-1a      ", old_hash, 1000000);
+    quality("String::hash", new_hash, 1000000);
+    std::cout << std::endl;
+}
+
+// --- 12. Splitting a big CSV file ---
+const char *CSV_PATH = "/tmp/string_benchmark.csv";
+
+void write_csv(size_t mb)
+{
+    FILE *f = fopen(CSV_PATH, "wb");
+    if (!f)
+        throw std::runtime_error("Cannot create test file");
+    StringBuilder row;
+    size_t target = mb * 1024 * 1024, written = 0;
+    unsigned x = 1;
+    char buf[64];
+    while (written < target)
+    {
+        // id,user,method,path,status,latency
+        for (int i = 0; i < 10000; i++)
+        {
+            x = x * 1103515245 + 12345;
+            std::to_chars_result r = String::to_chars(buf, buf + 64, x % 1000000);
+            row << StringView(buf, r.ptr - buf) << ",user_" << StringView(buf, r.ptr - buf)
+                << ((x & 1) ? ",GET," : ",POST,") << "/api/v1/items/" << StringView(buf, 3)
+                << ",200," << "0.0" << StringView(buf, 2) << '\n';
+        }
+        String chunk = row.str();
+        fwrite(chunk.c_str(), 1, chunk.size(), f);
+        written += chunk.size();
+        row.clear();
+    }
+    fclose(f);
+}
+
+void bench_csv(size_t mb)
+{
+    std::cout << "--- 12. Split a " << mb << " MB CSV into fields ---" << std::endl;
+    write_csv(mb);
+
+    // Old way : iostream getline , a String per line , find + substr per field
+    auto start = Clock::now();
+    size_t fields = 0;
+    {
+        std::ifstream in(CSV_PATH);
+        std::string tmp;
+        while (std::getline(in, tmp))
+        {
+            String line(tmp.c_str());
+            size_t from = 0;
+            while (true)
+            {
+                size_t comma = line.find(',', from);
+                String field = line.substr(from, comma == String::npos ? String::npos : comma - from);
+                fields += field.size() > 0;
+                if (comma == String::npos)
+                    break;
+                from = comma + 1;
+            }
+        }
+    }
+    double ms = ms_since(start);
+    std::cout << "ifstream + find + substr     : " << ms << " ms (" << mb / (ms / 1000) << " MB/s)" << std::endl;
+
+    // getline reusing one String + lazy split
+    start = Clock::now();
+    size_t fields2 = 0;
+    {
+        std::ifstream in(CSV_PATH);
+        String line;
+        while (getline(in, line))
+            for (StringView field : line.split(','))
+                fields2 += field.size() > 0;
+    }
+    ms = ms_since(start);
+    std::cout << "getline(String&) + split     : " << ms << " ms (" << mb / (ms / 1000) << " MB/s)" << std::endl;
+
+    // LineReader views + lazy split : no allocation per line or field
+    start = Clock::now();
+    size_t fields3 = 0;
+    {
+        LineReader in(CSV_PATH);
+        StringView line;
+        while (in.next(line))
+            for (StringView field : split(line, ','))
+                fields3 += field.size() > 0;
+    }
+    ms = ms_since(start);
+    std::cout << "LineReader + split (views)   : " << ms << " ms (" << mb / (ms / 1000) << " MB/s)" << std::endl;
+    std::cout << "Same field count : " << (fields == fields2 && fields2 == fields3 ? "yes" : "NO") << std::endl;
+    std::cout << std::endl;
+    remove(CSV_PATH);
+}
+
+// --- 13. Time to first search : mmap vs reading the file into a String ---
+// The file was just written , so it is mostly in the page cache : this measures the copy, not the disk.
+// On a cold file mmap wins even more on the early hit , it only reads the pages before the match.
+template <typename F>
+double first_search(F &&body)
+{
+    auto start = Clock::now();
+    sink = sink + body();
+    return ms_since(start);
+}
+
+String read_whole(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f)
+        throw std::runtime_error("Cannot open test file");
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    String all;
+    all.reserve(size);
+    std::vector<char> buf(1 << 20);
+    size_t got;
+    while ((got = fread(buf.data(), 1, buf.size(), f)) > 0)
+        all.append(StringView(buf.data(), got));
+    fclose(f);
+    return all;
+}
+
+void bench_mmap(size_t mb)
+{
+    std::cout << "--- 13. Time to first search in a " << mb << " MB file ---" << std::endl;
+    write_csv(mb);
+    const char *cases[2][2] = {{"early hit ", ",user_4242,"}, {"no match  ", "qzxjwv"}};
+
+    for (auto &c : cases)
+    {
+        size_t a = 0, b = 0;
+        double read_ms = first_search([&]
+                                      {
+                                          String all = read_whole(CSV_PATH);
+                                          return a = all.find(c[1]); });
+        double map_ms = first_search([&]
+                                     {
+                                         MappedFile file(CSV_PATH);
+                                         return b = file.find(c[1]); });
+        std::cout << c[0] << ": read into String + find : " << read_ms << " ms , MappedFile + find : " << map_ms
+                  << " ms (" << read_ms / map_ms << "x) , same result : " << (a == b ? "yes" : "NO") << std::endl;
+    }
+    std::cout << std::endl;
+    remove(CSV_PATH);
+}
+
+// --- 14. Minimum flips to an alternating string ---
+// The old minOperations : string by value , i % 2 and two branches per char
+int min_operations_old(std::string s)
+{
+    int n = s.length();
+    int flips_pattern1 = 0;
+    int flips_pattern2 = 0;
+    for (int i = 0; i < n; i++)
+    {
+        if (i % 2 == 0)
+        {
+            if (s[i] != '0')
+                flips_pattern1++;
+            if (s[i] != '1')
+                flips_pattern2++;
+        }
+        else
+        {
+            if (s[i] != '1')
+                flips_pattern1++;
+            if (s[i] != '0')
+                flips_pattern2++;
+        }
+    }
+    return std::min(flips_pattern1, flips_pattern2);
+}
+
+void bench_flips(size_t n, int reps)
+{
+    std::cout << "--- 14. Minimum flips to alternate , " << n / (1024 * 1024) << " MB binary string x " << reps << " ---" << std::endl;
+    std::string bits(n, '0');
+    unsigned x = 7;
+    for (char &c : bits)
+    {
+        x = x * 1103515245 + 12345;
+        c = (x >> 16) & 1 ? '1' : '0';
+    }
+    StringView view(bits.data(), bits.size());
+    double mb = (double)n * reps / (1024 * 1024);
+    size_t a = 0, b = 0, c = 0;
+
+    auto start = Clock::now();
+    for (int r = 0; r < reps; r++)
+        a += min_operations_old(bits);
+    double ms = ms_since(start);
+    std::cout << "minOperations(string) : " << ms << " ms (" << mb / (ms / 1000) << " MB/s)" << std::endl;
+
+    start = Clock::now();
+    for (int r = 0; r < reps; r++)
+        b += AlternatingFlips::min_flips(view);
+    ms = ms_since(start);
+    std::cout << "min_flips (SIMD)      : " << ms << " ms (" << mb / (ms / 1000) << " MB/s)" << std::endl;
+
+    start = Clock::now();
+    for (int r = 0; r < reps; r++)
+        c += AlternatingFlips::min_flips_parallel(view);
+    ms = ms_since(start);
+    std::cout << "min_flips_parallel    : " << ms << " ms (" << mb / (ms / 1000) << " MB/s , "
+              << std::thread::hardware_concurrency() << " threads)" << std::endl;
+    std::cout << "Same answer : " << (a == b && b == c ? "yes" : "NO") << std::endl;
+    sink = sink + a;
+    std::cout << std::endl;
+}
+
+// --- 15. Distance to a periodic pattern , every alignment in one pass ---
+void bench_pattern(size_t mb)
+{
+    std::cout << "--- 15. Distance of " << mb << " MB of DNA to every rotation of a pattern ---" << std::endl;
+    std::string dna(mb * 1024 * 1024, 'A');
+    unsigned x = 99;
+    for (char &c : dna)
+    {
+        x = x * 1103515245 + 12345;
+        c = "ACGT"[(x >> 16) & 3];
+    }
+    StringView view(dna.data(), dna.size());
+
+    for (const char *pattern : {"ACGT", "GATTACA"})
+    {
+        size_t k = strlen(pattern);
+        // Plain loop , one pass per alignment
+        auto start = Clock::now();
+        std::vector<size_t> slow(k, 0);
+        for (size_t j = 0; j < k; j++)
+            for (size_t i = 0; i < dna.size(); i++)
+                slow[j] += dna[i] != pattern[(i + j) % k];
+        double slow_ms = ms_since(start);
+
+        start = Clock::now();
+        std::vector<size_t> fast = PatternDistance::rotations(pattern).distances(view);
+        double fast_ms = ms_since(start);
+
+        std::cout << pattern << " (" << k << " alignments) : plain loops " << slow_ms << " ms , PatternDistance "
+                  << fast_ms << " ms (" << slow_ms / fast_ms << "x , " << mb * k / (fast_ms / 1000) << " MB x pattern/s)"
+                  << " , same : " << (slow == fast ? "yes" : "NO") << std::endl;
+    }
+    std::cout << std::endl;
+}
+
+void bench_files(size_t mb)
+{
+    bench_csv(mb);
+    bench_mmap(mb);
+    bench_pattern(mb);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 1 && strcmp(argv[1], "io") == 0)
+    {
+        bench_files(argc > 2 ? strtoul(argv[2], nullptr, 10) : 1024);
+        return 0;
+    }
+
+    bench_sso(10000000);
+    bench_view(2000000);
+    bench_search(16 * 1024 * 1024);
+    bench_append();
+    bench_rope(10 * 1024 * 1024, 2000);
+    bench_builder(10000000);
+    bench_compare(1000000);
+    bench_numbers(10000000);
+    bench_shared(2000000);
+    bench_pool(4000000, 20000);
+    bench_hash();
+    bench_flips(64 * 1024 * 1024, 4);
+    return 0;
+}
@@ -0,0 +1,89 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include "ADT/PatternDistance.hpp"
+using namespace std;
+// Generalization of "minimum flips to make alternating strings" : the target is any pattern repeated
+// ("01" -> 0101... , "abc" -> abcabc... , "ACGT" -> ACGTACGT...) and the answer is the number of chars to change.
+// Checked here against the plain O(n * k) definitions on random inputs.
+
+// Plain definition : compare every char with the pattern char at the same index
+size_t slow_distance(const string &s, const string &p)
+{
+    size_t d = 0;
+    for (size_t i = 0; i < s.size(); i++)
+        if (s[i] != p[i % p.size()])
+            d++;
+    return d;
+}
+
+// Plain definition of the rotation version : build every rotation of s
+size_t slow_rotations(const string &s, const string &p)
+{
+    size_t best = slow_distance(s, p);
+    for (size_t t = 1; t < s.size(); t++)
+        best = min(best, slow_distance(s.substr(t) + s.substr(0, t), p));
+    return best;
+}
+
+StringView view(const string &s) { return StringView(s.data(), s.size()); }
+
+int main()
+{
+    cout << PatternDistance::distance("0100", "01") << endl;        // 1 (same as minOperations)
+    cout << PatternDistance::distance("abcabdabc", "abc") << endl;  // 1
+    cout << PatternDistance::min_over_rotations("111000", "01") << endl; // 2 : rotate to "011100" -> 010101
+    cout << PatternDistance::min_over_rotations("111000", "10") << endl; // 2
+
+    // All 4 alignments of "ACGT" in one pass
+    PatternDistance shifts = PatternDistance::rotations("ACGT");
+    vector<size_t> d = shifts.distances("CGTACGTA");
+    for (size_t x : d)
+        cout << x << " "; // 8 0 8 8 : "CGTA" matches everything
+    cout << endl;
+
+    // Streaming : distance of the last 6 chars to "ab" repeated
+    SlidingPatternDistance window("ab", 6);
+    for (char c : string("xxababab"))
+    {
+        window.push(c);
+        if (window.full())
+            cout << window.distance() << " "; // 2 6 0 ("xababa" is "bababa" shifted : all 5 wrong + x)
+    }
+    cout << endl;
+
+    // Random checks against the plain definitions
+    unsigned x = 12345;
+    auto next = [&x]() { x = x * 1103515245 + 12345; return x >> 16; };
+    int failed = 0;
+    for (int round = 0; round < 2000; round++)
+    {
+        size_t n = next() % 300, k = 1 + next() % 40, letters = 1 + next() % 4;
+        string s(n, 'a'), p(k, 'a');
+        for (char &c : s)
+            c = "ACGT"[next() % letters];
+        for (char &c : p)
+            c = "ACGT"[next() % letters];
+
+        vector<size_t> all = PatternDistance::rotations(view(p)).distances(view(s));
+        for (size_t j = 0; j < k; j++)
+            if (all[j] != slow_distance(s, p.substr(j) + p.substr(0, j)))
+                failed++;
+        if (n > 0 && PatternDistance::min_over_rotations(view(s), view(p)) != slow_rotations(s, p))
+            failed++;
+
+        if (n > 0)
+        {
+            size_t w = 1 + next() % n;
+            SlidingPatternDistance sliding(view(p), w);
+            for (size_t i = 0; i < n; i++)
+            {
+                sliding.push(s[i]);
+                if (sliding.full() && sliding.distance() != slow_distance(s.substr(i + 1 - w, w), p))
+                    failed++;
+            }
+        }
+    }
+    cout << (failed == 0 ? "All checks passed" : "Some checks FAILED") << endl;
+    return failed != 0;
+}
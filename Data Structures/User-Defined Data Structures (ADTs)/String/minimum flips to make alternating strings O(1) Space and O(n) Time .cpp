@@ -1,32 +1,25 @@
 #include <iostream>
-#include <stack>
-#include <vector>
+#include <string>
+#include "ADT/AlternatingFlips.hpp"
 using namespace std;
-int minOperations(string s) 
+// The counting now lives in ADT/AlternatingFlips.hpp :
+// the string is taken as a view (no copy) and 32 / 64 chars are checked at a time with SIMD.
+// Each block is XORed with "0101..." : chars matching "0101..." become 0 , chars matching "1010..." become 1.
+// Comparing with 0 and with 1 gives one bit per char (movemask) , and popcount of each mask counts the
+// matches of both patterns at once. Flips for a pattern = length - its matches , the answer is the smaller one.
+int minOperations(StringView s)
     {
-        int n = s.length();
-        // flips_pattern1 corresponds to pattern: 010101...
-        // flips_pattern2 corresponds to pattern: 101010...
-        int flips_pattern1 = 0;
-        int flips_pattern2 = 0;
-        for (int i = 0; i < n; i++) {
-        // Even index
-        if (i % 2 == 0) {
-        // Pattern 1 expects ’0’, Pattern 2 expects ’1’
-        if (s[i] != '0') flips_pattern1++;
-        if (s[i] != '1') flips_pattern2++;
-        }
-        // Odd index
-        else {
-        // Pattern 1 expects ’1’, Pattern 2 expects ’0’
-        if (s[i] != '1') flips_pattern1++;
-        if (s[i] != '0') flips_pattern2++;
-        }
-        }
-        return min(flips_pattern1, flips_pattern2);        
+        return (int)AlternatingFlips::min_flips(s);
     }
 int main()
 {
-    
+    string s = "0100";
+    cout << minOperations(StringView(s.data(), s.size())) << endl; // 1 : "0101"
+    cout << minOperations("10") << endl;                          // 0
+    cout << minOperations("1111") << endl;                        // 2 : "0101" or "1010"
+
+    // Very large inputs can be split between threads
+    string big(50000000, '1');
+    cout << AlternatingFlips::min_flips_parallel(StringView(big.data(), big.size())) << endl; // 25000000
     return 0;
-}
\ No newline at end of file
+}
@@ -3,17 +3,187 @@
 #include <string>
 #include <stdexcept>
 #include <initializer_list>
+#include <new>
+#include <utility>
+#include <cstring>
+#include <type_traits>
+#include <memory>
 using namespace std;
 
-template <typename T>
+// Storage Model :
+// Like std::vector , this Vector separates memory from objects.
+// arr points to raw (uninitialized) memory big enough for CAP objects.
+// Only the first SIZE slots hold real (constructed) objects , the rest [SIZE , CAP) is just empty land.
+// So reserve() / push_back() only pay for the elements that actually exist,
+// and pop_back() / clear() / erase() really destroy the objects instead of keeping dead ones alive.
+// If we used new T[CAP] instead , every growth would default construct CAP objects and then
+// move-assign over them , which doubles the constructor calls for types like std::string.
+
+// Allocator :
+// All memory is taken and given back through Alloc (std::allocator by default , which uses new / delete).
+// Any std::allocator-compatible type can be plugged in , e.g ArenaAllocator from ../Allocator/Arena.hpp :
+// Arena arena;
+// Vector<int, ArenaAllocator<int>> v(ArenaAllocator<int>(arena));
+// We never call Alloc directly but through std::allocator_traits , which fills in defaults
+// (construct , destroy , propagation rules) for allocators that only define allocate / deallocate.
+template <typename T, typename Alloc = std::allocator<T>>
 class Vector
 {
+    using traits = std::allocator_traits<Alloc>;
+
     int SIZE;
     int CAP;
     T *arr;
+    [[no_unique_address]] Alloc alloc; // Empty allocators (like std::allocator) take no space
+
+    // --- RAW MEMORY HELPERS ---
+    // Grabs raw memory for n objects from allocator a , no constructor of T is called here.
+    static T *allocate(Alloc &a, int n)
+    {
+        // Even though we put try catch inside main , we put this when user requests large memory to be allocated
+        // This error will still be caught inside main if we do try-catch there
+        // But then our arr , becomes a dangling pointer.
+        try
+        {
+            return traits::allocate(a, n); // Try to get new memory
+        }
+        catch (const std::bad_alloc &)
+        {
+            // If it fails, we catch it here and re-throw.
+            // Importantly: 'arr' is still intact! The vector is still valid.
+            throw std::runtime_error("Vector reserve failed: Out of memory.");
+        }
+    }
+
+    // n must be the same count that was passed to allocate()
+    static void deallocate(Alloc &a, T *p, int n)
+    {
+        if (p != nullptr)
+        {
+            traits::deallocate(a, p, n);
+        }
+    }
+
+    // Calls destructors of the objects living in [from , to) , memory stays with us
+    void destroy(int from, int to)
+    {
+        for (int i = from; i < to; i++)
+        {
+            traits::destroy(alloc, arr + i);
+        }
+    }
+
+    // Builds an object in slot i : slots below SIZE are alive so we assign , others are raw so we construct
+    template <typename U>
+    void put(int i, U &&val)
+    {
+        if (i < SIZE)
+        {
+            arr[i] = std::forward<U>(val);
+        }
+        else
+        {
+            traits::construct(alloc, arr + i, std::forward<U>(val));
+        }
+    }
+
+    // Doubling growth , CAP is 0 only for a moved-from vector
+    int grown_cap() const
+    {
+        return (CAP == 0) ? 1 : CAP * 2;
+    }
+
+    // Types like int , double or plain structs can be moved around as raw bytes.
+    // For them one memcpy / memmove call beats any element by element loop (it uses SIMD internally).
+    // For all other types (std::string , Vector<int> ...) we must go through their constructors.
+    static constexpr bool trivial = std::is_trivially_copyable<T>::value;
+
+    // Moves n objects from src into raw memory dest , the source objects are destroyed afterwards.
+    void relocate(T *dest, T *src, int n)
+    {
+        if constexpr (trivial)
+        {
+            if (n > 0)
+            {
+                memcpy(dest, src, sizeof(T) * n);
+            }
+        }
+        else
+        {
+            for (int i = 0; i < n; i++)
+            {
+                traits::construct(alloc, dest + i, std::move(src[i]));
+                traits::destroy(alloc, src + i);
+            }
+        }
+    }
+
+    // Opens a gap of n slots at ind by shifting [ind , SIZE) to the right.
+    // Slots of the gap that were alive keep their (moved-from) objects , others stay raw.
+    // Caller must fill the gap with put() and then increase SIZE.
+    void open_gap(int ind, int n)
+    {
+        if constexpr (trivial)
+        {
+            memmove(arr + ind + n, arr + ind, sizeof(T) * (SIZE - ind)); // memmove because ranges overlap
+        }
+        else
+        {
+            for (int i = SIZE + n - 1; i >= ind + n; i--)
+            {
+                put(i, std::move(arr[i - n]));
+            }
+        }
+    }
+
+    // Removes the n objects at ind by shifting [ind + n , SIZE) to the left and decreases SIZE.
+    void close_gap(int ind, int n)
+    {
+        if constexpr (trivial)
+        {
+            memmove(arr + ind, arr + ind + n, sizeof(T) * (SIZE - ind - n));
+        }
+        else
+        {
+            for (int i = ind; i < SIZE - n; i++)
+            {
+                arr[i] = std::move(arr[i + n]);
+            }
+            destroy(SIZE - n, SIZE); // Last n slots only hold moved-from objects now
+        }
+        SIZE -= n;
+    }
+
+    // Takes over the buffer of other (used by moves) , other is left empty with no buffer
+    void steal(Vector &other)
+    {
+        SIZE = other.SIZE;
+        CAP = other.CAP;
+        arr = other.arr;
+
+        other.arr = nullptr;
+        other.SIZE = 0;
+        other.CAP = 0;
+    }
 
 public:
-    Vector(int s = 0, T val = 0)
+    // Separate default constructor so T doesn't need to be default constructible for an empty vector
+    Vector() : alloc()
+    {
+        SIZE = 0;
+        CAP = 1;
+        arr = allocate(alloc, CAP);
+    }
+
+    // Empty vector that takes its memory from a (e.g an arena)
+    explicit Vector(const Alloc &a) : alloc(a)
+    {
+        SIZE = 0;
+        CAP = 1;
+        arr = allocate(alloc, CAP);
+    }
+
+    Vector(int s, const T &val = T(), const Alloc &a = Alloc()) : alloc(a)
     {
         if (s < 0)
         {
@@ -31,27 +201,15 @@ public:
             CAP = s;
         }
 
-        // Even though we put try catch inside main , we put this when user requests large memory to be allocated
-        // This error will still be caught inside main if we do try-catch there
-        // But then our arr , becomes a dangling pointer.
-        try
-        {
-            arr = new T[CAP]; // Try to get new memory
-        }
-        catch (const std::bad_alloc &)
-        {
-            // If it fails, we catch it here and re-throw.
-            // Importantly: 'arr' is still intact! The vector is still valid.
-            throw std::runtime_error("Vector reserve failed: Out of memory.");
-        }
+        arr = allocate(alloc, CAP);
 
         for (int i = 0; i < SIZE; i++)
         {
-            arr[i] = val;
+            traits::construct(alloc, arr + i, val);
         }
     }
 
-    Vector(initializer_list<T> list)
+    Vector(initializer_list<T> list, const Alloc &a = Alloc()) : alloc(a)
     {
         SIZE = list.size();
 
@@ -64,24 +222,12 @@ public:
             CAP = 1;
         }
 
-        // Even though we put try catch inside main , we put this when user requests large memory to be allocated
-        // This error will still be caught inside main if we do try-catch there
-        // But then our arr , becomes a dangling pointer.
-        try
-        {
-            arr = new T[CAP]; // Try to get new memory
-        }
-        catch (const std::bad_alloc &)
-        {
-            // If it fails, we catch it here and re-throw.
-            // Importantly: 'arr' is still intact! The vector is still valid.
-            throw std::runtime_error("Vector reserve failed: Out of memory.");
-        }
+        arr = allocate(alloc, CAP);
 
         int i = 0;
         for (const T &item : list)
         {
-            arr[i] = item;
+            traits::construct(alloc, arr + i, item);
             i++;
         }
     }
@@ -103,27 +249,17 @@ public:
 
         if (r <= SIZE)
         {
+            destroy(r, SIZE);
             SIZE = r;
         }
-        else if (r <= CAP)
+        else
         {
-            int old_s = SIZE;
-            SIZE = r;
-            for (int i = old_s; i < SIZE; i++)
+            reserve(r); // Does nothing if r <= CAP
+            for (int i = SIZE; i < r; i++)
             {
-                arr[i] = 0;
+                traits::construct(alloc, arr + i);
             }
-        }
-        else // r > CAP
-        {
-            int old_s = SIZE;
-            reserve(r);
-            CAP = r;
             SIZE = r;
-            for (int i = old_s; i < SIZE; i++)
-            {
-                arr[i] = 0;
-            }
         }
     }
     void reserve(int r)
@@ -133,37 +269,54 @@ public:
             return;
         }
 
-        T *temp = nullptr;
-        // Even though we put try catch inside main , we put this when user requests large memory to be allocated
-        // This error will still be caught inside main if we do try-catch there
-        // But then our arr , becomes a dangling pointer.
-        try
-        {
-            temp = new T[r]; // Try to get new memory
-        }
-        catch (const std::bad_alloc &)
-        {
-            // If it fails, we catch it here and re-throw.
-            // Importantly: 'arr' is still intact! The vector is still valid.
-            throw std::runtime_error("Vector reserve failed: Out of memory.");
-        }
-        for (int i = 0; i < SIZE; i++)
-        {
-            temp[i] = move(arr[i]);
-        }
-        delete[] arr;
+        T *temp = allocate(alloc, r);
+        relocate(temp, arr, SIZE);
+        deallocate(alloc, arr, CAP);
         arr = temp;
         CAP = r;
     }
 
-    void push_back(T val)
+    // Constructs the new element directly inside the vector from the given arguments.
+    // e.g : Vector<string> v; v.emplace_back(5, 'a'); builds "aaaaa" in place , no temporary string at all.
+    template <typename... Args>
+    T &emplace_back(Args &&...args)
     {
         if (SIZE == CAP)
         {
-            reserve(CAP * 2);
+            // Build the new element in the new block before moving the old ones,
+            // because args may refer to an element of this vector (v.emplace_back(v[0])).
+            int new_cap = grown_cap();
+            T *temp = allocate(alloc, new_cap);
+            try
+            {
+                traits::construct(alloc, temp + SIZE, std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                deallocate(alloc, temp, new_cap);
+                throw;
+            }
+            relocate(temp, arr, SIZE);
+            deallocate(alloc, arr, CAP);
+            arr = temp;
+            CAP = new_cap;
+        }
+        else
+        {
+            traits::construct(alloc, arr + SIZE, std::forward<Args>(args)...);
         }
-        arr[SIZE] = val;
         SIZE++;
+        return arr[SIZE - 1];
+    }
+
+    // lvalues are copied once , rvalues (temporaries or std::move) are only moved
+    void push_back(const T &val)
+    {
+        emplace_back(val);
+    }
+    void push_back(T &&val)
+    {
+        emplace_back(std::move(val));
     }
     void pop_back()
     {
@@ -171,7 +324,7 @@ public:
         {
             throw out_of_range("Vector Empty\n");
         }
-        arr[SIZE - 1] = 0;
+        traits::destroy(alloc, arr + SIZE - 1);
         SIZE--;
     }
 
@@ -182,25 +335,17 @@ public:
             return;
         }
 
-        if (SIZE == 0)
-        {
-            delete[] arr;
-            CAP = 1;
-            arr = new T[CAP];
-            arr[0] = 0;
-            return;
-        }
-        T *temp = new T[SIZE];
-        for (int i = 0; i < SIZE; i++)
-        {
-            temp[i] = arr[i];
-        }
-        delete[] arr;
+        // Empty vector still keeps room for one element (same as constructor)
+        int new_cap = (SIZE == 0) ? 1 : SIZE;
+        T *temp = allocate(alloc, new_cap);
+        relocate(temp, arr, SIZE);
+        deallocate(alloc, arr, CAP);
         arr = temp;
-        CAP = SIZE;
+        CAP = new_cap;
     }
     void clear()
     {
+        destroy(0, SIZE);
         SIZE = 0;
     }
 
@@ -245,14 +390,14 @@ public:
         return arr[SIZE - 1];
     }
 
-    Vector(const Vector &other)
+    Vector(const Vector &other) : alloc(traits::select_on_container_copy_construction(other.alloc))
     {
         SIZE = other.SIZE;
         CAP = other.CAP;
-        arr = new T[CAP];
+        arr = allocate(alloc, CAP);
         for (int i = 0; i < SIZE; i++)
         {
-            arr[i] = other.arr[i];
+            traits::construct(alloc, arr + i, other.arr[i]);
         }
     }
 
@@ -260,46 +405,72 @@ public:
     {
         if (this != &other)
         {
-            delete[] arr;
-            SIZE = other.SIZE;
-            CAP = other.CAP;
-            arr = new T[CAP];
-            for (int i = 0; i < SIZE; i++)
+            // Some allocators want the copy to use the source's allocator (e.g the same arena)
+            Alloc new_alloc = alloc;
+            if constexpr (traits::propagate_on_container_copy_assignment::value)
             {
-                arr[i] = other.arr[i];
+                new_alloc = other.alloc;
             }
+
+            T *temp = allocate(new_alloc, other.CAP); // Allocate first so a failure leaves us untouched
+            for (int i = 0; i < other.SIZE; i++)
+            {
+                traits::construct(new_alloc, temp + i, other.arr[i]);
+            }
+            destroy(0, SIZE);
+            deallocate(alloc, arr, CAP);
+            alloc = new_alloc;
+            arr = temp;
+            SIZE = other.SIZE;
+            CAP = other.CAP;
         }
         return *this;
     }
 
-    Vector(Vector &&other) noexcept
+    Vector(Vector &&other) noexcept : alloc(std::move(other.alloc))
     {
-        SIZE = other.SIZE;
-        CAP = other.CAP;
-        arr = other.arr;
-
-        other.arr = nullptr;
-        other.SIZE = 0;
-        other.CAP = 0;
+        steal(other);
     }
 
-    Vector &operator=(Vector &&other) noexcept
+    Vector &operator=(Vector &&other) noexcept(traits::propagate_on_container_move_assignment::value ||
+                                               traits::is_always_equal::value)
     {
         if (this != &other)
         {
-            delete[] arr;
-
-            SIZE = other.SIZE;
-            CAP = other.CAP;
-            arr = other.arr;
+            destroy(0, SIZE);
+            deallocate(alloc, arr, CAP);
 
-            other.arr = nullptr;
-            other.SIZE = 0;
-            other.CAP = 0;
+            if constexpr (traits::propagate_on_container_move_assignment::value)
+            {
+                alloc = std::move(other.alloc);
+                steal(other);
+            }
+            else if (alloc == other.alloc)
+            {
+                steal(other);
+            }
+            else
+            {
+                // Our allocator can't free other's buffer , so the elements are moved one by one
+                SIZE = 0;
+                CAP = 0;
+                arr = nullptr;
+                reserve(other.SIZE > 0 ? other.SIZE : 1);
+                for (int i = 0; i < other.SIZE; i++)
+                {
+                    emplace_back(std::move(other.arr[i]));
+                }
+                other.clear();
+            }
         }
         return *this;
     }
 
+    Alloc get_allocator() const
+    {
+        return alloc;
+    }
+
     friend ostream &operator<<(ostream &out, const Vector &other)
     {
         // Can use vector's display() function as well
@@ -333,6 +504,12 @@ public:
         temp_s = CAP;
         CAP = other.CAP;
         other.CAP = temp_s;
+
+        // Each buffer must stay with the allocator that made it
+        if constexpr (traits::propagate_on_container_swap::value)
+        {
+            std::swap(alloc, other.alloc);
+        }
     }
 
     bool operator==(const Vector &other) const
@@ -483,7 +660,8 @@ public:
     }
     ~Vector()
     {
-        delete[] arr;
+        destroy(0, SIZE);
+        deallocate(alloc, arr, CAP);
     }
 
     class Iterator
@@ -499,6 +677,7 @@ public:
             begin_ptr = first;
             end_ptr = last;
         }
+        Iterator(const Iterator &other) = default; // Declared because operator= below is user-written
         T &operator*()
         {
             if (ptr < begin_ptr || ptr > end_ptr)
@@ -623,36 +802,66 @@ public:
         return Iterator(arr + SIZE, arr, arr + SIZE);
     }
 
-    // Integer Based :
-    void insert(int value, int ind)
+    // Integer Based (Construct in place) :
+    template <typename... Args>
+    void emplace_at(int ind, Args &&...args)
     {
         if (ind < 0 || ind > SIZE)
         {
             throw out_of_range("Index Out of Range (Not Possible)\n");
         }
 
-        if (SIZE == CAP)
+        if (ind == SIZE)
         {
-            reserve(CAP * 2);
+            emplace_back(std::forward<Args>(args)...);
+            return;
         }
 
-        for (int i = SIZE; i > ind; i--)
+        // In the middle the element is built first and then moved into the gap (like std::vector does),
+        // so args referring to an element of this vector stay valid while we shift.
+        T temp(std::forward<Args>(args)...);
+
+        if (SIZE == CAP)
         {
-            arr[i] = arr[i - 1];
+            reserve(grown_cap());
         }
 
-        arr[ind] = value;
+        open_gap(ind, 1);
+        put(ind, std::move(temp));
         SIZE++;
     }
 
-    // Iterator Based (Single Value):
-    Iterator insert(Iterator i, T val)
+    // Iterator Based (Construct in place) :
+    template <typename... Args>
+    Iterator emplace(Iterator i, Args &&...args)
     {
         int ind = i - begin();
-        insert(ind, val); // Index is checked in insert as well
+        emplace_at(ind, std::forward<Args>(args)...);
         return Iterator(arr + ind, arr, arr + SIZE);
     }
 
+    // Integer Based :
+    void insert(const T &value, int ind)
+    {
+        emplace_at(ind, value);
+    }
+
+    void insert(T &&value, int ind)
+    {
+        emplace_at(ind, std::move(value));
+    }
+
+    // Iterator Based (Single Value):
+    Iterator insert(Iterator i, const T &val)
+    {
+        return emplace(i, val); // Index is checked in emplace_at as well
+    }
+
+    Iterator insert(Iterator i, T &&val)
+    {
+        return emplace(i, std::move(val));
+    }
+
     // Iterator Based (Fill n values) :
     void insert(Iterator i, int n, T val)
     {
@@ -662,21 +871,18 @@ public:
             reserve((SIZE + n) * 2);
         }
 
-        for (int i = SIZE + n - 1; i >= ind + n; i--)
-        {
-            arr[i] = arr[i - n];
-        }
+        open_gap(ind, n);
 
         for (int i = 0; i < n; i++)
         {
-            arr[ind + i] = val;
+            put(ind + i, val);
         }
 
         SIZE += n;
     }
 
     // Iterator Based (Range) :
-    void insert(Iterator i, Iterator first, Iterator last)
+    Iterator insert(Iterator i, Iterator first, Iterator last)
     {
         int n = last - first;
         int ind = i - begin();
@@ -686,14 +892,11 @@ public:
             reserve((SIZE + n) * 2);
         }
 
-        for (int i = SIZE + n - 1; i >= ind + n; i--)
-        {
-            arr[i] = arr[i - n];
-        }
+        open_gap(ind, n);
 
         for (int i = 0; i < n; i++)
         {
-            arr[ind + i] = first[i];
+            put(ind + i, first[i]);
         }
 
         SIZE += n;
@@ -708,11 +911,7 @@ public:
             throw out_of_range("Index Out of Range (Not Possible)\n");
         }
 
-        for (int i = ind; i < SIZE - 1; i++)
-        {
-            arr[i] = arr[i + 1];
-        }
-        SIZE--;
+        close_gap(ind, 1);
     }
 
     // Iterator based (single element) :
@@ -734,12 +933,7 @@ public:
             return first;
         }
 
-        for (int i = start_ind; i < SIZE - nums; i++)
-        {
-            arr[i] = arr[i + nums];
-        }
-
-        SIZE -= nums;
+        close_gap(start_ind, nums);
 
         return Iterator(arr + start_ind, arr, arr + SIZE);
     }
@@ -0,0 +1,163 @@
+#include "Vector.hpp"
+#include <iostream>
+#include <string>
+#include <chrono>
+
+// Benchmarks for Vector.hpp
+// Compile with optimizations on , otherwise the numbers mean nothing :
+// g++ -std=c++17 -O2 benchmark.cpp -o benchmark
+
+using Clock = std::chrono::steady_clock;
+
+double ms_since(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// A non-trivial type that counts every constructor / assignment call made on it.
+// It holds a std::string so copies and default constructions cost something real.
+struct Tracked
+{
+    static long long default_ctor, copy_ctor, move_ctor, copy_assign, move_assign, dtor;
+    std::string payload;
+
+    Tracked() { default_ctor++; }
+    Tracked(const std::string &s) : payload(s) { copy_ctor++; }
+    Tracked(const Tracked &other) : payload(other.payload) { copy_ctor++; }
+    Tracked(Tracked &&other) noexcept : payload(std::move(other.payload)) { move_ctor++; }
+    Tracked &operator=(const Tracked &other)
+    {
+        payload = other.payload;
+        copy_assign++;
+        return *this;
+    }
+    Tracked &operator=(Tracked &&other) noexcept
+    {
+        payload = std::move(other.payload);
+        move_assign++;
+        return *this;
+    }
+    ~Tracked() { dtor++; }
+
+    static void reset()
+    {
+        default_ctor = copy_ctor = move_ctor = copy_assign = move_assign = dtor = 0;
+    }
+    static void report(const char *label, double ms)
+    {
+        std::cout << label << " : " << ms << " ms"
+                  << " | default ctor " << default_ctor
+                  << " | copy ctor " << copy_ctor
+                  << " | move ctor " << move_ctor
+                  << " | copy assign " << copy_assign
+                  << " | move assign " << move_assign
+                  << " | dtor " << dtor << std::endl;
+    }
+};
+long long Tracked::default_ctor = 0, Tracked::copy_ctor = 0, Tracked::move_ctor = 0;
+long long Tracked::copy_assign = 0, Tracked::move_assign = 0, Tracked::dtor = 0;
+
+// The old storage model of Vector.hpp (new T[CAP] + move assign on growth) kept here for comparison only.
+template <typename T>
+class OldVector
+{
+    int SIZE = 0;
+    int CAP = 1;
+    T *arr = new T[1];
+
+public:
+    ~OldVector() { delete[] arr; }
+    void reserve(int r)
+    {
+        if (r <= CAP)
+            return;
+        T *temp = new T[r];
+        for (int i = 0; i < SIZE; i++)
+            temp[i] = std::move(arr[i]);
+        delete[] arr;
+        arr = temp;
+        CAP = r;
+    }
+    void push_back(T val)
+    {
+        if (SIZE == CAP)
+            reserve(CAP * 2);
+        arr[SIZE] = val;
+        SIZE++;
+    }
+};
+
+// --- 1. Growth : construction traffic of push_back ---
+void bench_growth(int n)
+{
+    std::cout << "--- 1. push_back of " << n << " Tracked objects (growth from capacity 1) ---" << std::endl;
+    Tracked item(std::string(32, 'x')); // Longer than SSO so every copy allocates
+
+    Tracked::reset();
+    auto start = Clock::now();
+    {
+        OldVector<Tracked> v;
+        for (int i = 0; i < n; i++)
+            v.push_back(item);
+    }
+    Tracked::report("new T[CAP] storage ", ms_since(start));
+
+    Tracked::reset();
+    start = Clock::now();
+    {
+        Vector<Tracked> v;
+        for (int i = 0; i < n; i++)
+            v.push_back(item);
+    }
+    Tracked::report("raw storage         ", ms_since(start));
+    std::cout << std::endl;
+}
+
+// Same data as an int , but the user-provided copy makes it non-trivially copyable.
+// So Vector<Boxed> takes the element by element path while Vector<int> takes the memmove path.
+struct Boxed
+{
+    int v;
+    Boxed(int x = 0) : v(x) {}
+    Boxed(const Boxed &other) : v(other.v) {}
+    Boxed &operator=(const Boxed &other)
+    {
+        v = other.v;
+        return *this;
+    }
+};
+
+// --- 2. Trivially copyable fast path : front insert and middle erase ---
+template <typename T>
+void front_insert_and_mid_erase(const char *label, int n)
+{
+    Vector<T> v;
+    auto start = Clock::now();
+    for (int i = 0; i < n; i++)
+        v.insert(v.begin(), T(i)); // Every insert shifts the whole vector by one
+    double insert_ms = ms_since(start);
+
+    start = Clock::now();
+    while (v.size() > n / 2)
+        v.erase(v.size() / 2); // Every erase shifts the second half back by one
+    double erase_ms = ms_since(start);
+
+    std::cout << label << " : front insert " << insert_ms << " ms (" << n / insert_ms << " ops/ms)"
+              << " | mid erase " << erase_ms << " ms (" << (n - n / 2) / erase_ms << " ops/ms)" << std::endl;
+}
+
+void bench_trivial_relocation(int n)
+{
+    std::cout << "--- 2. " << n << " front inserts then " << n - n / 2 << " middle erases ---" << std::endl;
+    front_insert_and_mid_erase<int>("Vector<int>   (memmove)     ", n);
+    front_insert_and_mid_erase<double>("Vector<double> (memmove)    ", n);
+    front_insert_and_mid_erase<Boxed>("Vector<Boxed> (element-wise)", n);
+    std::cout << std::endl;
+}
+
+int main()
+{
+    bench_growth(1000000);
+    bench_trivial_relocation(50000);
+    return 0;
+}
@@ -2,8 +2,34 @@
 #include <iostream>
 #include <string>
 
+// Counts how many times it gets copied or moved , used to check that rvalue inserts never copy.
+struct Counter
+{
+    static int copies, moves;
+    std::string name;
+
+    Counter(const std::string &n) : name(n) {}
+    Counter(const Counter &other) : name(other.name) { copies++; }
+    Counter(Counter &&other) noexcept : name(std::move(other.name)) { moves++; }
+    Counter &operator=(const Counter &other)
+    {
+        name = other.name;
+        copies++;
+        return *this;
+    }
+    Counter &operator=(Counter &&other) noexcept
+    {
+        name = std::move(other.name);
+        moves++;
+        return *this;
+    }
+};
+int Counter::copies = 0;
+int Counter::moves = 0;
+
 int main()
 {
+    bool failed = false;
     try
     {
         std::cout << "--- 1. Testing Initializer List & Iterators ---" << std::endl;
@@ -41,7 +67,26 @@ int main()
 
         std::cout << "Modified Nums: " << nums; // Uses your friend operator<<
 
-        std::cout << "\n--- 5. Testing Exception Safety ---" << std::endl;
+        std::cout << "\n--- 5. Testing Emplace & Rvalue Inserts (Zero Copies) ---" << std::endl;
+        Vector<Counter> people;
+        for (int i = 0; i < 100; i++)
+        {
+            people.emplace_back("Person " + std::to_string(i));    // Built in place
+            people.push_back(Counter("Temp " + std::to_string(i))); // Temporary gets moved
+        }
+        people.insert(Counter("Front"), 0);
+        people.emplace(people.begin() + 1, "Second");
+        people.insert(people.begin() + 2, Counter("Third"));
+
+        std::cout << "Size: " << people.size() << " | Front: " << people.front().name << std::endl;
+        std::cout << "Copies (should be 0): " << Counter::copies << " | Moves: " << Counter::moves << std::endl;
+        if (Counter::copies != 0)
+        {
+            std::cerr << "FAILED : emplace / rvalue inserts made " << Counter::copies << " copies" << std::endl;
+            failed = true;
+        }
+
+        std::cout << "\n--- 6. Testing Exception Safety ---" << std::endl;
         // This should trigger your out_of_range exception
         std::cout << "Trying to access index 100..." << std::endl;
         std::cout << nums.at(100) << std::endl;
@@ -51,5 +96,5 @@ int main()
         std::cerr << "EXCEPTION CAUGHT: " << e.what() << std::endl;
     }
 
-    return 0;
+    return failed ? 1 : 0;
 }
\ No newline at end of file